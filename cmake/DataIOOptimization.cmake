@@ -0,0 +1,49 @@
+# data_io_optimize( <target> )
+#
+# Apply the optimization pipeline selected by DATA_IO_* variables to given target, so that
+# interface implementations and their users may be built with the same flags:
+#   DATA_IO_ENABLE_LTO    - link-time (interprocedural) optimization
+#   DATA_IO_MARCH         - target architecture passed as -march (GCC/Clang)
+#   DATA_IO_PGO           - profile-guided optimization stage: OFF, GENERATE or USE (GCC/Clang)
+#   DATA_IO_PGO_DIRECTORY - directory of profiles written (GENERATE) or read (USE)
+
+include_guard( GLOBAL )
+
+include( CheckIPOSupported )
+
+function( data_io_optimize TARGET_NAME )
+  if( CMAKE_C_COMPILER_ID MATCHES "GNU|Clang" OR CMAKE_CXX_COMPILER_ID MATCHES "GNU|Clang" )
+    set( IS_GNU_LIKE TRUE )
+  endif()
+
+  if( DATA_IO_ENABLE_LTO )
+    check_ipo_supported( RESULT IPO_SUPPORTED OUTPUT IPO_ERROR )
+    if( IPO_SUPPORTED )
+      set_property( TARGET ${TARGET_NAME} PROPERTY INTERPROCEDURAL_OPTIMIZATION TRUE )
+    else()
+      message( WARNING "DataIO: link-time optimization not supported: ${IPO_ERROR}" )
+    endif()
+  endif()
+
+  if( DATA_IO_MARCH AND IS_GNU_LIKE )
+    target_compile_options( ${TARGET_NAME} PRIVATE -march=${DATA_IO_MARCH} )
+  endif()
+
+  if( DATA_IO_PGO STREQUAL "GENERATE" )
+    set( PGO_FLAGS -fprofile-generate=${DATA_IO_PGO_DIRECTORY} )
+  elseif( DATA_IO_PGO STREQUAL "USE" )
+    # Clang reads merged profile (llvm-profdata merge -output=default.profdata *.profraw), GCC reads .gcda files
+    if( CMAKE_C_COMPILER_ID MATCHES "Clang" OR CMAKE_CXX_COMPILER_ID MATCHES "Clang" )
+      set( PGO_FLAGS -fprofile-use=${DATA_IO_PGO_DIRECTORY}/default.profdata )
+    else()
+      set( PGO_FLAGS -fprofile-use=${DATA_IO_PGO_DIRECTORY} -fprofile-correction -Wno-missing-profile )
+    endif()
+  elseif( DATA_IO_PGO AND NOT DATA_IO_PGO STREQUAL "OFF" )
+    message( FATAL_ERROR "DataIO: invalid DATA_IO_PGO value: ${DATA_IO_PGO} (expected OFF, GENERATE or USE)" )
+  endif()
+
+  if( PGO_FLAGS AND IS_GNU_LIKE )
+    target_compile_options( ${TARGET_NAME} PRIVATE ${PGO_FLAGS} )
+    target_link_options( ${TARGET_NAME} PRIVATE ${PGO_FLAGS} )
+  endif()
+endfunction()
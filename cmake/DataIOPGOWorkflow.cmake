@@ -0,0 +1,79 @@
+# Profile-guided optimization workflow, run in script mode:
+#
+#   cmake -DBACKEND=<library target> -DSOURCE_DIR=<project> [-DBINARY_DIR=<directory>]
+#         [-DTRAINING_ARGUMENTS="1000;20"] [-DCONFIGURE_OPTIONS="-D...;-D..."] -P cmake/DataIOPGOWorkflow.cmake
+#
+# SOURCE_DIR is the project building the implementation: it must add this repository with add_subdirectory()
+# (so that data_io_training and the data_io_train target exist) and apply data_io_optimize() to the BACKEND
+# shared library target, which is then rebuilt on every stage. A prebuilt library file is rejected, as its code
+# would be neither instrumented nor optimized.
+#
+# SOURCE_DIR is built 3 times, running the data_io_training workload with BACKEND after each build:
+#   baseline - no PGO, for reference timings
+#   generate - instrumented build (DATA_IO_PGO=GENERATE), whose run writes the profiles
+#   use      - build optimized with collected profiles (DATA_IO_PGO=USE), in the same tree (GCC profiles are named after object paths)
+# Baseline and optimized timings are reported at the end
+
+cmake_minimum_required( VERSION 3.13 )
+
+if( NOT BACKEND )
+  message( FATAL_ERROR "DataIO PGO: BACKEND (implementation library target) not defined" )
+endif()
+if( BACKEND MATCHES "[/\\\\]|\\.(so|dylib|dll)(\\.|$)" )
+  message( FATAL_ERROR "DataIO PGO: BACKEND must be a library target built by SOURCE_DIR, not a file (${BACKEND})" )
+endif()
+if( NOT SOURCE_DIR )
+  message( FATAL_ERROR "DataIO PGO: SOURCE_DIR (project building BACKEND and adding this repository) not defined" )
+endif()
+if( NOT EXISTS ${SOURCE_DIR}/CMakeLists.txt )
+  message( FATAL_ERROR "DataIO PGO: SOURCE_DIR has no CMakeLists.txt (${SOURCE_DIR})" )
+endif()
+if( NOT BINARY_DIR )
+  set( BINARY_DIR ${CMAKE_CURRENT_BINARY_DIR}/pgo-build )
+endif()
+if( NOT TRAINING_ARGUMENTS )
+  set( TRAINING_ARGUMENTS "1000;20" )
+endif()
+
+set( PROFILE_DIR ${BINARY_DIR}/profiles )
+
+macro( run_step )
+  execute_process( COMMAND ${ARGN} RESULT_VARIABLE STEP_RESULT OUTPUT_VARIABLE STEP_OUTPUT ERROR_VARIABLE STEP_OUTPUT )
+  if( NOT STEP_RESULT EQUAL 0 )
+    message( FATAL_ERROR "DataIO PGO: step failed (${ARGN}):\n${STEP_OUTPUT}" )
+  endif()
+endmacro()
+
+function( build_and_train STAGE_DIR PGO_MODE OUTPUT_VARIABLE_NAME )
+  message( STATUS "DataIO PGO: building ${STAGE_DIR} (DATA_IO_PGO=${PGO_MODE})" )
+  run_step( ${CMAKE_COMMAND} -S ${SOURCE_DIR} -B ${STAGE_DIR} -DCMAKE_BUILD_TYPE=Release
+            -DDATA_IO_PGO=${PGO_MODE} -DDATA_IO_PGO_DIRECTORY=${PROFILE_DIR} -DDATA_IO_BUILD_TRAINING=ON
+            -DDATA_IO_TRAINING_BACKEND=${BACKEND} "-DDATA_IO_TRAINING_ARGUMENTS=${TRAINING_ARGUMENTS}" ${CONFIGURE_OPTIONS} )
+  run_step( ${CMAKE_COMMAND} --build ${STAGE_DIR} )
+  run_step( ${CMAKE_COMMAND} --build ${STAGE_DIR} --target data_io_train )
+  set( ${OUTPUT_VARIABLE_NAME} "${STEP_OUTPUT}" PARENT_SCOPE )
+endfunction()
+
+build_and_train( ${BINARY_DIR}/baseline OFF BASELINE_OUTPUT )
+
+file( REMOVE_RECURSE ${PROFILE_DIR} )
+build_and_train( ${BINARY_DIR}/optimized GENERATE GENERATE_OUTPUT )
+
+# Clang writes raw profiles, to be merged in the file read by DATA_IO_PGO=USE builds
+file( GLOB RAW_PROFILES ${PROFILE_DIR}/*.profraw )
+if( RAW_PROFILES )
+  find_program( LLVM_PROFDATA NAMES llvm-profdata )
+  if( NOT LLVM_PROFDATA )
+    message( FATAL_ERROR "DataIO PGO: llvm-profdata, needed to merge Clang profiles, not found" )
+  endif()
+  run_step( ${LLVM_PROFDATA} merge -output=${PROFILE_DIR}/default.profdata ${RAW_PROFILES} )
+endif()
+
+build_and_train( ${BINARY_DIR}/optimized USE OPTIMIZED_OUTPUT )
+
+string( REGEX MATCHALL "[a-z]+: [0-9.]+ s" BASELINE_TIMES "${BASELINE_OUTPUT}" )
+string( REGEX MATCHALL "[a-z]+: [0-9.]+ s" OPTIMIZED_TIMES "${OPTIMIZED_OUTPUT}" )
+string( REPLACE ";" "\n  " BASELINE_TIMES "${BASELINE_TIMES}" )
+string( REPLACE ";" "\n  " OPTIMIZED_TIMES "${OPTIMIZED_TIMES}" )
+message( STATUS "DataIO PGO: baseline timings:\n  ${BASELINE_TIMES}" )
+message( STATUS "DataIO PGO: optimized timings:\n  ${OPTIMIZED_TIMES}" )
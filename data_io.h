@@ -24,6 +24,24 @@
 /// @brief Data read/write functions
 ///
 /// Common data storage (e.g. file, server) and string parsing/querying/saving interface to be used for different implementations
+///
+/// Common behavior, for every implementation:
+/// - value paths are made of level keys and zero-based list indexes (in decimal form), separated by "."; "" refers to the given data itself
+/// - paths through missing fields, out of range indexes or fields of other types count as not found (getters return default value, NULL, 0 or false)
+/// - NULL data references are accepted everywhere and treated as empty data (setters/insertions fail)
+/// - setting an existing key replaces its value, whatever its previous type; NULL key appends only to lists (fails on levels)
+/// - returned internal references (inner data, strings) stay valid until the referred field is changed or the root data is unloaded
+/// - inner data references are stable: getting the same level/list again (or given data through "" path) returns the same reference
+/// - DataIO_CreateEmptyData gives an empty level as root (so NULL key insertions on it fail)
+///
+/// Thread safety: storage and string loading and serialization of distinct data structures may run concurrently.
+/// Calls on the same data structure (or on references obtained from it) follow its DataConcurrencyMode
+/// (DATA_IO_SINGLE_THREAD, the default, requires external locking for any concurrent use). Exceptions:
+/// - DataIO_ListStorageDataEntries returns a static buffer: it can't run concurrently with itself
+/// - DataIO_SetBaseStoragePath changes global state: it can't run concurrently with any storage loading or listing
+/// - getters of mounted storage directories parse entries on first access: call DataIO_LoadAllStorageEntries before concurrent reads
+/// - serialization (DataIO_GetDataString, DataIO_WriteDataToBuffer and similar) with DATA_IO_SERIALIZE_INCREMENTAL updates cached text
+///   of the data structure: it can't run concurrently with other serialization or setters on it (concurrent getters are unaffected)
 
 #ifndef DATA_IO_H
 #define DATA_IO_H
@@ -31,27 +49,274 @@
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
-#define DATA_IO_MAX_PATH_LENGTH 256         ///< Maximum length of storage or value (inside data structure) path string
-#define DATA_IO_MAX_VALUE_LENGTH 128        ///< Maximum length of value string inside data structure
+#define DATA_IO_MAX_PATH_LENGTH 256         ///< Maximum length of formatted value path string (deprecated: length-aware functions have no limit)
+#define DATA_IO_MAX_VALUE_LENGTH 128        ///< Maximum length of value string (deprecated: length-aware functions have no limit)
+
+#define DATA_IO_BACKEND_VARIABLE "DATA_IO_BACKEND"   ///< Environment variable with backend library loaded by dispatcher library, if none is selected
 
 typedef void* DataHandle;                   ///< Opaque reference to internal data structure  
+
+/// Text/binary format of storage entries and data strings
+typedef enum DataFormat {
+  DATA_IO_FORMAT_DEFAULT,                   ///< Implementation native format
+  DATA_IO_FORMAT_AUTO,                      ///< Automatic detection from data content (loading only)
+  DATA_IO_FORMAT_UNKNOWN,                   ///< Format not recognized (detection result only)
+  DATA_IO_FORMAT_JSON,                      ///< JSON (".json")
+  DATA_IO_FORMAT_YAML,                      ///< YAML block/flow mappings and sequences subset, no anchors or tags (".yaml", ".yml")
+  DATA_IO_FORMAT_INI,                       ///< INI sections (levels) of key=value pairs (".ini", ".cfg")
+  DATA_IO_FORMAT_CSV,                       ///< Comma-separated values, first line as header (".csv"). Loaded as level of column lists keyed by header names, numeric columns packed (see DataIO_GetNumericArray)
+  DATA_IO_FORMAT_IMAGE,                     ///< Read-only binary image (starting with DATA_IO_IMAGE_SIGNATURE)
+  DATA_IO_FORMAT_DIRECTORY                  ///< Storage directory, loaded as level keyed by entry names (without extension)
+} DataFormat;
+
+/// Storage entry description returned by listing
+typedef struct DataStorageEntry {
+  const char* name;                         ///< Entry name, relative to listed storage path
+  uint64_t size;                            ///< Entry size, in bytes
+  int64_t modifiedTime;                     ///< Last modification time, in nanoseconds since Unix epoch
+  DataFormat format;                        ///< Entry format (from its name extension, DATA_IO_FORMAT_UNKNOWN if not recognized)
+  bool isDirectory;                         ///< Whether entry contains other entries
+} DataStorageEntry;
+
+/// Description of last storage/string loading failure
+typedef struct DataError {
+  const char* storagePath;                  ///< Path of failed storage entry (NULL for string loading)
+  size_t line;                              ///< Line of first error (starting at 1, 0 if not a parsing error)
+  size_t column;                            ///< Column of first error, in bytes (starting at 1)
+  size_t offset;                            ///< Offset of first error from data start, in bytes
+  const char* message;                      ///< Error description
+} DataError;
+
+#define DATA_IO_SERIALIZE_COMPACT 0x0       ///< Serialization option: no optional whitespace (default)
+#define DATA_IO_SERIALIZE_PRETTY 0x1        ///< Serialization option: line breaks and indentation for human reading
+#define DATA_IO_SERIALIZE_INCREMENTAL 0x2   ///< Serialization option: cache serialized text of inner levels/lists and only render again the ones changed since last serialization (serializing then writes, see thread safety)
+
+/// Value type of data structure fields
+typedef enum DataValueType { 
+  DATA_IO_TYPE_NONE,                        ///< Field not found or with no defined value
+  DATA_IO_TYPE_NUMERIC,                     ///< Numeric value (floating point format)
+  DATA_IO_TYPE_STRING,                      ///< String value
+  DATA_IO_TYPE_BOOLEAN,                     ///< Boolean value
+  DATA_IO_TYPE_LIST,                        ///< List of index-accessed fields
+  DATA_IO_TYPE_LEVEL                        ///< Nesting level of key-accessed fields
+} DataValueType;
+
+#define DATA_IO_IMAGE_SIGNATURE "DATAIMG"   ///< Initial bytes (including terminating NUL) of read-only binary image storage
+#define DATA_IO_IMAGE_VERSION 1             ///< Layout version of read-only binary image storage
+
+/// Read-only binary image storage header, placed at the image start.
+/// All offsets are in bytes, relative to the image start and little-endian, so the image is valid wherever it is mapped
+typedef struct DataImageHeader {
+  char signature[ 8 ];                      ///< DATA_IO_IMAGE_SIGNATURE
+  uint32_t version;                         ///< DATA_IO_IMAGE_VERSION
+  uint32_t nodesCount;                      ///< Total number of nodes in the image
+  uint64_t imageSize;                       ///< Total image size, in bytes
+  uint64_t rootOffset;                      ///< Offset of root node
+} DataImageHeader;
+
+/// Read-only binary image storage node (8-byte aligned).
+/// Children of list/level nodes are stored contiguously, level children in ascending unsigned byte-wise key order
+/// (as compared by strcmp/memcmp), with no duplicate keys, so any reader may binary search images written by any implementation
+typedef struct DataImageNode {
+  uint32_t type;                            ///< DataValueType of the node
+  uint32_t length;                          ///< Number of children (list/level) or string value length (string)
+  uint64_t keyOffset;                       ///< Offset of NUL-terminated key string (0 for root and list elements)
+  union { 
+    double number;                          ///< Numeric value
+    uint64_t boolean;                       ///< Boolean value (0 for false)
+    uint64_t offset;                        ///< Offset of NUL-terminated string value or of first child node
+  } value;
+} DataImageNode;
+
+/// Pre-split value path segment (string key or numeric index), to reach values with no path formatting or parsing
+typedef struct DataPathSegment {
+  const char* key;                          ///< Key string, not necessarily NUL-terminated (NULL for index segment)
+  size_t keyLength;                         ///< Number of characters of the key
+  size_t index;                             ///< List index (used if key is NULL)
+} DataPathSegment;
+
+#define DATA_IO_KEY_SEGMENT( keyLiteral ) { keyLiteral, sizeof(keyLiteral) - 1, 0 }  ///< Initializer of key path segment from string literal
+#define DATA_IO_INDEX_SEGMENT( listIndex ) { NULL, 0, listIndex }                    ///< Initializer of index path segment
+
+/// Single value request for grouped value reading (DataIO_GetMany)
+typedef struct DataQuery {
+  const char* path;                         ///< Value path inside the data structure (key or index fields separated by ".")
+  DataValueType type;                       ///< Requested value type (DATA_IO_TYPE_LIST for list size, DATA_IO_TYPE_LEVEL for inner level/list reference)
+  union {
+    double number;                          ///< Default value for numeric requests
+    const char* string;                     ///< Default value for string requests
+    bool boolean;                           ///< Default value for boolean requests
+  } defaultValue;                           ///< Value written to outValue if field is not found (NULL/0 for list and level requests)
+  void* outValue;                           ///< Pointer to result (double*, const char**, bool*, size_t* or DataHandle*, according to type)
+} DataQuery;
+
+/// Allowed concurrent use of a data structure (and of inner data references obtained from it)
+typedef enum DataConcurrencyMode {
+  DATA_IO_SINGLE_THREAD,                    ///< No concurrent calls at all (callers lock externally)
+  DATA_IO_CONCURRENT_READS,                 ///< Lock-free concurrent getters, while no setter/insertion call runs
+  DATA_IO_CONCURRENT_SUBTREES               ///< Lock-free concurrent getters, plus concurrent setters/insertions on disjoint inner data references (getters see each value either old or new)
+} DataConcurrencyMode;
+
+typedef void* DataPoolHandle;               ///< Opaque reference to internal pool of reusable data structures
+
+typedef void* DataBatchHandle;              ///< Opaque reference to internal list of pending data structure changes
+
+/// Fixed location holding value of a bound numeric/boolean field, updated by setters (see DataIO_BindNumericValue).
+/// On every change, implementations atomically store the value (__atomic_store or C11 atomic_store, release order), then increment
+/// the version with release order (__atomic_add_fetch( &version, 1, __ATOMIC_RELEASE )) and wake its waiters.
+/// Readers use the inline accessors (acquire loads), so a reader seeing a new version always sees the value stored before it
+typedef struct DataNumericSlot {
+  double value;                             ///< Current field value (8-byte aligned, 0.0 or 1.0 for boolean fields)
+  uint32_t version;                         ///< Incremented after every field change (futex-waitable word on Linux)
+} DataNumericSlot;
+
+typedef const DataNumericSlot* DataNumericBinding;   ///< Read-only reference to bound numeric/boolean field slot
+
+typedef void* DataWatchHandle;              ///< Opaque reference to internal field change callback registration
+
+/// @brief Function called after a watched field changes, on the thread of the changing call (should not change the data itself)
+/// @param[in] data reference to internal data structure passed on watch registration
+/// @param[in] path path of changed field inside the data structure
+/// @param[in] userData user pointer passed on watch registration
+typedef void (*DataChangeCallback)( DataHandle data, const char* path, void* userData );
+
+typedef void* DataServerHandle;             ///< Opaque reference to internal storage server
+
+#define DATA_IO_UNIX_ADDRESS_PREFIX "unix:"  ///< Storage path prefix for server reached through Unix domain socket (e.g. "unix:/tmp/data.sock#entry")
+#define DATA_IO_TCP_ADDRESS_PREFIX "tcp:"    ///< Storage path prefix for server reached through TCP (e.g. "tcp:127.0.0.1:50000#entry")
+/// Separator of server address and entry name in server storage paths: the address ends at the first one (socket paths
+/// can't contain it, entry names can), and an empty entry name refers to the served storage itself
+#define DATA_IO_ENTRY_SEPARATOR '#'
+
+/// Storage server protocol message types
+typedef enum DataMessageType {
+  DATA_IO_MESSAGE_LOAD = 1,                 ///< Request: load storage entry (payload: entry name). Reply: binary image of entry data
+  DATA_IO_MESSAGE_LIST,                     ///< Request: list storage entries (payload: storage path, optionally followed by NUL and name filter). Reply: NUL-separated entry names, or entry info records with DATA_IO_MESSAGE_FLAG_ENTRY_INFO
+  DATA_IO_MESSAGE_ERROR,                    ///< Reply: request failed (payload: error message)
+  DATA_IO_MESSAGE_SUBSCRIBE,                ///< Request: receive updates for loaded entry (payload: entry name, NUL, path prefix)
+  DATA_IO_MESSAGE_UNSUBSCRIBE,              ///< Request: stop receiving updates (payload: entry name, NUL, path prefix)
+  DATA_IO_MESSAGE_UPDATE                    ///< Pushed by server (requestID of subscription): changed fields, as back-to-back update records (see below)
+} DataMessageType;
+
+/// Update message records are unaligned and packed until payloadLength, each made of:
+/// - field path, relative to entry root, as 2 bytes little-endian segments count followed by that many segments (like DataPathSegment):
+///   key ones as 4 bytes little-endian key length plus that many bytes, not NUL-terminated (so keys may contain "." or NUL),
+///   index ones as 4 bytes 0xFFFFFFFF plus 8 bytes little-endian index
+/// - 1 byte DataValueType of the new field value (DATA_IO_TYPE_NONE for field removal)
+/// - value: 8 bytes IEEE 754 little-endian double (numeric), 1 byte 0 or 1 (boolean), 4 bytes little-endian length plus
+///   that many bytes, not NUL-terminated (string), nothing (removal, list or level). A list/level record replaces the field
+///   with an empty one, its content following as records with longer paths (same leading segments)
+
+/// List request flag: reply with back-to-back (unaligned) entry info records, each made of 8 bytes little-endian size,
+/// 8 bytes little-endian modification time (nanoseconds since Unix epoch), 1 byte DataFormat, 1 byte directory flag (0 or 1),
+/// and NUL-terminated entry name
+#define DATA_IO_MESSAGE_FLAG_ENTRY_INFO 0x0001
+
+/// Storage server protocol message header (little-endian), followed by payloadLength bytes.
+/// Clients may send many requests before reading replies (pipelining), replies come back in request order with the same requestID
+typedef struct DataMessageHeader {
+  uint32_t requestID;                       ///< Client chosen identifier, echoed on reply
+  uint16_t type;                            ///< DataMessageType of the message
+  uint16_t flags;                           ///< Bitwise OR of DATA_IO_MESSAGE_FLAG_* (0 if none)
+  uint64_t payloadLength;                   ///< Message payload size, in bytes
+} DataMessageHeader;
         
 #ifdef __cplusplus  
 extern "C" {  // only need to export C interface if used by C++ source code  
 #endif
         
+/// @brief Load implementation library to which dispatcher library calls are forwarded (replacing the current one)
+/// @param[in] libraryPath backend shared library file path or name (as in dlopen)
+/// @return true if backend is loaded and provides all core functions, false otherwise (current backend is kept)
+/// @note only provided by dispatcher library, not thread-safe. Data created through previous backend must be unloaded before
+bool DataIO_SelectBackend( const char* libraryPath );
+
+/// @brief Get function of current dispatcher backend directly, e.g. to check if an optional one is implemented
+/// @param[in] functionName name of the DataIO_* function (e.g. "DataIO_GetMany")
+/// @return function address, to be cast to the declared function type (NULL if not available)
+/// @note only provided by dispatcher library, which forwards every interface function. Optional ones missing in the backend are emulated through core ones
+///       where possible (length-aware/pre-split path and grouped getters, buffer serialization, error reporting), the others fail (reported once on stderr)
+void* DataIO_GetBackendFunction( const char* functionName );
+
 /// @brief Create implementation specific empty data structure object 
 /// @return reference/pointer to newly created internal data structure (NULL on errors)
 DataHandle DataIO_CreateEmptyData( void );
 
+/// @brief Create empty data structure object fully stored inside given memory block, with no further heap allocations
+/// @param[in] memoryBlock caller-owned memory (max_align_t aligned) to hold the data structure, valid until it's unloaded
+/// @param[in] blockSize size of given memory block, in bytes
+/// @return reference/pointer to newly created internal data structure (NULL on errors or too small block)
+/// @note getter, setter and insertion functions on the returned data structure never allocate and run in time proportional to path depth. When the block is full, setters return false and insertions return NULL, leaving data unchanged
+DataHandle DataIO_CreateBoundedData( void* memoryBlock, size_t blockSize );
+
+/// @brief Get remaining capacity of data structure created with DataIO_CreateBoundedData
+/// @param[in] data reference to internal data structure
+/// @return number of free bytes left in the data memory block (0 for full or unbounded data structures)
+size_t DataIO_GetFreeCapacity( DataHandle data );
+
+/// @brief Create pool of reusable data structure objects, to avoid allocator calls on frequent creation/destruction
+/// @param[in] maxIdleDataCount maximum number of unloaded data structures kept for reuse (others are deallocated)
+/// @return reference/pointer to newly created pool (NULL on errors)
+DataPoolHandle DataIO_CreateDataPool( size_t maxIdleDataCount );
+
+/// @brief Get empty data structure object from given pool (reset idle one or newly created)
+/// @param[in] pool reference to internal pool
+/// @return reference/pointer to empty internal data structure (NULL on errors), returned to the pool by DataIO_UnloadData
+/// @note thread-safe: calls to this function and DataIO_UnloadData on data of the same pool may run concurrently from any threads
+DataHandle DataIO_CreatePooledData( DataPoolHandle pool );
+
+/// @brief Deallocate given pool and all its idle data structures
+/// @param[in] pool reference to internal pool (data structures taken from it and still in use must be unloaded before, with no concurrent pool calls)
+void DataIO_DestroyDataPool( DataPoolHandle pool );
+
+/// @brief Define allowed concurrent use of given data structure, before it's shared between threads
+/// @param[in] data reference to root internal data structure
+/// @param[in] mode desired concurrency mode
+/// @return true if mode is supported by the implementation, false otherwise (mode remains unchanged)
+bool DataIO_SetConcurrencyMode( DataHandle data, DataConcurrencyMode mode );
+
 /// @brief Load all given storage to fill implementation specific data structure
 /// @param[in] storagePath path (e.g. directory or address) to data storage
 /// @return reference/pointer to created and filled data structure (NULL on errors)
+/// @note storage paths starting with DATA_IO_UNIX_ADDRESS_PREFIX or DATA_IO_TCP_ADDRESS_PREFIX (address, DATA_IO_ENTRY_SEPARATOR and entry name) are requested from storage server,
+/// and loaded as writable private copy of its image reply (local changes aren't sent back, and may be overwritten by subscribed updates)
+/// @note parser is chosen by DataIO_GetStorageFormat
+/// @note directory storages are mounted: each entry becomes a level field, parsed only when first accessed
+/// @note storages starting with DATA_IO_IMAGE_SIGNATURE are memory mapped and used in place, with no parsing (read-only data, pages shared between processes)
 DataHandle DataIO_LoadStorageData( const char* storagePath );
 
+/// @brief Parse all not yet accessed entries of given mounted storage directory (e.g. before sharing data between threads)
+/// @param[in] data reference to internal data structure loaded from storage directory
+/// @return true if all entries are loaded successfully, false otherwise
+/// @note required before using DATA_IO_CONCURRENT_READS or DATA_IO_CONCURRENT_SUBTREES, as lazy loading changes data inside getters
+bool DataIO_LoadAllStorageEntries( DataHandle data );
+
+/// @brief Get format of given storage entry, from its signature (magic bytes) or else its name extension
+/// @param[in] storagePath path (e.g. directory or address) to data storage
+/// @return detected storage format (DATA_IO_FORMAT_UNKNOWN if not recognized)
+DataFormat DataIO_GetStorageFormat( const char* storagePath );
+
+/// @brief Write given data structure to storage as position-independent read-only binary image
+/// @param[in] data reference to internal data structure to be written
+/// @param[in] storagePath path (e.g. directory or address) to image storage
+/// @return true if image is written successfully, false otherwise
+bool DataIO_WriteStorageImage( DataHandle data, const char* storagePath );
+
+/// @brief Verify if given data structure can't be modified (e.g. mapped from binary image)
+/// @param[in] data reference to internal data structure
+/// @return true if setter/insertion functions will fail for given data structure, false otherwise
+bool DataIO_IsReadOnlyData( DataHandle data );
+
+/// @brief Get description of last failed storage or string loading on the calling thread
+/// @return reference to thread-local error description, valid until next loading call on the same thread (NULL if last loading succeeded)
+/// @note location is found by scanning the data again only after a failure, so successful loading has no extra cost
+const DataError* DataIO_GetLastError( void );
+
 /// @brief Overwrite default root storage path from which data sources will be searched                              
 /// @param[in] basePath path (e.g. directory or address) to desired storage root
+/// @note global setting, not thread-safe: call it before any concurrent storage loading or listing
 void DataIO_SetBaseStoragePath( const char* basePath );
                     
 /// @brief List all loadable entriens in given storage location
@@ -59,13 +324,80 @@ void DataIO_SetBaseStoragePath( const char* basePath );
 /// @return vector of storage entry names (NULL on errors), static buffer, not thread-safe
 const char** DataIO_ListStorageDataEntries( const char* storagePath );
 
+/// @brief List loadable entries in given storage location matching given filter, with their metadata, in one pass
+/// @param[in] storagePath path (e.g. directory or address) to data storage
+/// @param[in] nameFilter shell-style pattern ("*", "?" and "[...]", like in glob) entry names must match (NULL for all entries)
+/// @param[out] entriesCount pointer to be filled with number of listed entries (0 on errors)
+/// @return allocated array of storage entry descriptions, names included in the same block (needs to be manually deallocated with a single free).
+///         Successful listings with no matching entries still give a (freeable) non-NULL block, with *entriesCount set to 0: NULL is only returned on errors
+/// @note reentrant, for storage directories and servers (through DATA_IO_MESSAGE_FLAG_ENTRY_INFO list requests)
+DataStorageEntry* DataIO_ListStorageEntriesInfo( const char* storagePath, const char* nameFilter, size_t* entriesCount );
+
+/// @brief Load multiple storage entries at once (requests to the same server are pipelined in one batch)
+/// @param[in] storagePathsList list of paths (e.g. directory or address) to data storages
+/// @param[in] pathsCount number of storage paths on the list
+/// @param[out] dataList list (with pathsCount elements) to be filled with created data structures (NULL elements on errors)
+/// @return number of storage entries successfully loaded
+size_t DataIO_LoadStorageDataList( const char** storagePathsList, size_t pathsCount, DataHandle* dataList );
+
+/// @brief Start serving storage entries to clients (binary images of loaded data, shared by all clients)
+/// @param[in] serverAddress local address to listen to, with DATA_IO_UNIX_ADDRESS_PREFIX or DATA_IO_TCP_ADDRESS_PREFIX
+/// @param[in] storagePath path (e.g. directory) to served data storage
+/// @return reference/pointer to newly started storage server (NULL on errors)
+DataServerHandle DataIO_StartStorageServer( const char* serverAddress, const char* storagePath );
+
+/// @brief Get served data of given storage entry, to be changed by the server process (e.g. with setters or write batches)
+/// @param[in] server reference to internal storage server
+/// @param[in] entryName name of served storage entry (loaded on first request)
+/// @return reference/pointer to server side data structure (NULL on errors), valid until server is stopped
+/// @note changes are sent to clients by DataIO_PublishServedData and seen by later load requests. Served storage files aren't reloaded
+DataHandle DataIO_GetServedData( DataServerHandle server, const char* entryName );
+
+/// @brief Push changes made to served data since last call to subscribed clients (one update message per subscription)
+/// @param[in] server reference to internal storage server
+/// @return number of changed fields published
+size_t DataIO_PublishServedData( DataServerHandle server );
+
+/// @brief Stop given storage server, closing its connections and releasing served data
+/// @param[in] server reference to internal storage server
+void DataIO_StopStorageServer( DataServerHandle server );
+
+/// @brief Receive changes of fields under given path from storage server, for data loaded from it
+/// @param[in] data reference to internal data structure loaded from storage server
+/// @param[in] pathPrefix path inside the data structure (key or index fields separated by ".") whose changed fields will be pushed ("" for all)
+/// @return true if subscription is accepted by server, false otherwise
+bool DataIO_SubscribeStorageData( DataHandle data, const char* pathPrefix );
+
+/// @brief Stop receiving changes of fields under given path from storage server
+/// @param[in] data reference to internal data structure loaded from storage server
+/// @param[in] pathPrefix path previously passed to DataIO_SubscribeStorageData
+void DataIO_UnsubscribeStorageData( DataHandle data, const char* pathPrefix );
+
+/// @brief Apply pending changes pushed by storage server to given data structure (writable copy), in place (no reload)
+/// @param[in] data reference to internal data structure with subscribed paths
+/// @param[in] timeoutMs maximum time to wait for changes, in milliseconds (0 for no waiting, negative for infinite)
+/// @return number of changed fields updated
+size_t DataIO_UpdateStorageData( DataHandle data, int timeoutMs );
+
 /// @brief Parse given string to fill implementation specific data structure
 /// @param[in] dataString string containing data to be parsed
 /// @return reference/pointer to created and filled data structure (NULL on errors)
 DataHandle DataIO_LoadStringData( const char* dataString );
 
+/// @brief Parse given string (not necessarily NUL-terminated) to fill implementation specific data structure
+/// @param[in] dataString string containing data to be parsed
+/// @param[in] stringLength number of characters of the string to be parsed
+/// @return reference/pointer to created and filled data structure (NULL on errors)
+DataHandle DataIO_LoadStringDataN( const char* dataString, size_t stringLength );
+
+/// @brief Parse given string in specified format to fill implementation specific data structure
+/// @param[in] dataString string containing data to be parsed
+/// @param[in] format format of the string data (DATA_IO_FORMAT_DEFAULT for implementation native one, DATA_IO_FORMAT_AUTO for detection from content)
+/// @return reference/pointer to created and filled data structure (NULL on errors, unsupported or unrecognized format)
+DataHandle DataIO_LoadFormattedStringData( const char* dataString, DataFormat format );
+
 /// @brief Deallocate and destroys given data structure
-/// @param[in] data reference to internal data structure
+/// @param[in] data reference to internal data structure (unmapped, if loaded from binary image, or reset and kept for reuse, if taken from pool)
 void DataIO_UnloadData( DataHandle data );
 
 /// @brief Get given data structure content in serialized string form
@@ -73,11 +405,43 @@ void DataIO_UnloadData( DataHandle data );
 /// @return allocated pointer to serialized data string (needs to be manually deallocated)
 char* DataIO_GetDataString( DataHandle data );
 
+/// @brief Get given data structure content serialized in specified format
+/// @param[in] data reference to internal data structure to be serialized
+/// @param[in] format format of the output string (DATA_IO_FORMAT_DEFAULT for implementation native one)
+/// @return allocated pointer to serialized data string (needs to be manually deallocated, NULL on unsupported format, DATA_IO_FORMAT_AUTO or DATA_IO_FORMAT_UNKNOWN)
+/// @note CSV output requires a level of equally sized lists (columns), INI output a level of levels (sections)
+char* DataIO_GetFormattedDataString( DataHandle data, DataFormat format );
+
+/// @brief Write given data structure content in serialized string form to caller-provided buffer
+/// @param[in] data reference to internal data structure to be serialized
+/// @param[out] buffer memory to be filled with NUL-terminated serialized data string (may be NULL if capacity is 0)
+/// @param[in] capacity size of given buffer, in bytes
+/// @param[out] neededLength pointer to be filled with serialized string length, excluding terminating NUL, or 0 on errors (may be NULL)
+/// @return true if the whole string fits in the buffer, false otherwise (buffer content undefined): if *neededLength is not 0, grow buffer to *neededLength + 1 and retry, otherwise serialization failed
+bool DataIO_WriteDataToBuffer( DataHandle data, char* buffer, size_t capacity, size_t* neededLength );
+
+/// @brief Define how given data structure is serialized by DataIO_GetDataString and DataIO_WriteDataToBuffer
+/// @param[in] data reference to root internal data structure
+/// @param[in] options bitwise OR of DATA_IO_SERIALIZE_* flags
+/// @return true if options are supported by the implementation, false otherwise (options remain unchanged)
+bool DataIO_SetSerializationOptions( DataHandle data, int options );
+
+/// @brief Get upper bound of given data structure serialized string length, without serializing it
+/// @param[in] data reference to internal data structure to be serialized
+/// @return maximum number of characters (excluding terminating NUL) of serialized data string
+size_t DataIO_EstimateDataStringLength( DataHandle data );
+
+/// @brief Verify if two data structures hold the same content (e.g. for load/serialize/load round-trip checks)
+/// @param[in] data reference to first internal data structure
+/// @param[in] otherData reference to second internal data structure
+/// @return true if both have the same fields, value types and values (level key order ignored, NaN equal to NaN), false otherwise
+bool DataIO_CompareData( DataHandle data, DataHandle otherData );
+
 /// @brief Get reference to inner data level from given data strucuture
 /// @param[in] data reference to internal data structure where the value will be searched
 /// @param[in] pathFormat format string (like in printf) to value path inside the data structure (key or index fields separated by ".")
 /// @param[in] ... variable list of string keys or numeric indexes to build searched value path from pathFormat (like in printf)
-/// @return reference/pointer to internal data structure (NULL on errors)
+/// @return reference/pointer to internal data structure (NULL on errors or if found field is not a level/list)
 DataHandle DataIO_GetSubData( DataHandle data, const char* pathFormat, ... );
 
 /// @brief Get specified numeric value (floating point format) from given data strucuture
@@ -85,7 +449,7 @@ DataHandle DataIO_GetSubData( DataHandle data, const char* pathFormat, ... );
 /// @param[in] defaultValue value to be returned if specified field is not found
 /// @param[in] pathFormat format string (like in printf) to value path inside the data structure (key or index fields separated by ".")
 /// @param[in] ... variable list of string keys or numeric indexes to build searched value path from pathFormat (like in printf)
-/// @return numeric value (floating point format) found or the default one
+/// @return numeric value (floating point format) found or the default one (also for non-numeric fields, with no string conversion)
 double DataIO_GetNumericValue( DataHandle data, const double defaultValue, const char* pathFormat, ... );
 
 /// @brief Get specified string value from given data strucuture
@@ -93,7 +457,7 @@ double DataIO_GetNumericValue( DataHandle data, const double defaultValue, const
 /// @param[in] defaultValue value to be returned if specified field is not found
 /// @param[in] pathFormat format string (like in printf) to value path inside the data structure (key or index fields separated by ".")
 /// @param[in] ... variable list of string keys or numeric indexes to build searched value path from pathFormat (like in printf)
-/// @return string value found or the default one
+/// @return string value found (internal reference) or the default one (also for non-string fields)
 const char* DataIO_GetStringValue( DataHandle data, const char* defaultValue, const char* pathFormat, ... );
 
 /// @brief Get specified boolean value from given data strucuture
@@ -101,26 +465,43 @@ const char* DataIO_GetStringValue( DataHandle data, const char* defaultValue, co
 /// @param[in] defaultValue value to be returned if specified field is not found
 /// @param[in] pathFormat format string (like in printf) to value path inside the data structure (key or index fields separated by ".")
 /// @param[in] ... variable list of string keys or numeric indexes to build searched value path from pathFormat (like in printf)
-/// @return boolean value found or the default one
+/// @return boolean value found or the default one (also for non-boolean fields)
 bool DataIO_GetBooleanValue( DataHandle data, const bool defaultValue, const char* pathFormat, ... );
 
 /// @brief Get number of elements for specified list from given data strucuture
 /// @param[in] data reference to internal data structure where the list will be searched
 /// @param[in] pathFormat format string (like in printf) to list path inside the data structure (key or index fields separated by ".")
 /// @param[in] ... variable list of string keys or numeric indexes to build searched list path from pathFormat (like in printf)
-/// @return number of elements of the list (or 0 if list is not found)
+/// @return number of elements of the list (or 0 if list is not found or field is not a list)
 size_t DataIO_GetListSize( DataHandle data, const char* pathFormat, ... );
 
+/// @brief Get direct access to specified all-numeric list from given data strucuture, if stored as packed array
+/// @param[in] data reference to internal data structure where the list will be searched
+/// @param[out] listSize pointer to be filled with number of elements of the list (0 if not found/packed)
+/// @param[in] pathFormat format string (like in printf) to list path inside the data structure (key or index fields separated by ".")
+/// @param[in] ... variable list of string keys or numeric indexes to build searched list path from pathFormat (like in printf)
+/// @return internal read-only array of list values, valid until list is changed (NULL if list is not found or not packed)
+const double* DataIO_GetNumericArray( DataHandle data, size_t* listSize, const char* pathFormat, ... );
+
+/// @brief Copy numeric values of specified list from given data strucuture to caller-provided array
+/// @param[in] data reference to internal data structure where the list will be searched
+/// @param[out] valuesList array to be filled with list numeric values (NaN for non-numeric elements)
+/// @param[in] maxValuesCount maximum number of values to be copied
+/// @param[in] pathFormat format string (like in printf) to list path inside the data structure (key or index fields separated by ".")
+/// @param[in] ... variable list of string keys or numeric indexes to build searched list path from pathFormat (like in printf)
+/// @return number of values copied (0 if list is not found)
+size_t DataIO_CopyNumericList( DataHandle data, double* valuesList, size_t maxValuesCount, const char* pathFormat, ... );
+
 /// @brief Insert list on specified field of given data strucuture
 /// @param[in] data reference to internal data structure where the list will be placed
 /// @param[in] key string identifier of the field where the list will be placed (NULL for appending to list)
-/// @return reference/pointer to newly created internal data structure (NULL on errors)
+/// @return reference/pointer to newly created internal data structure, replacing any previous field value (NULL on errors)
 DataHandle DataIO_AddList( DataHandle data, const char* key );
 
 /// @brief Insert nesting level on specified field of given data strucuture
 /// @param[in] data reference to internal data structure where the nesting level will be added
 /// @param[in] key string identifier of the field where the nesting level will be added (NULL for appending to list)
-/// @return reference/pointer to newly created internal data structure (NULL on errors)
+/// @return reference/pointer to newly created internal data structure, replacing any previous field value (NULL on errors)
 DataHandle DataIO_AddLevel( DataHandle data, const char* key );
 
 /// @brief Set numeric value (floating point format) for specified field of given data strucuture
@@ -144,13 +525,364 @@ bool DataIO_SetStringValue( DataHandle data, const char* key, const char* value
 /// @return true if value is inserted successfully, false otherwise
 bool DataIO_SetBooleanValue( DataHandle data, const char* key, const bool value );
 
+/// @brief Start accumulating changes to be applied together to given data structure
+/// @param[in] data reference to internal data structure to be changed
+/// @return reference/pointer to newly created empty change list (NULL on errors)
+DataBatchHandle DataIO_CreateWriteBatch( DataHandle data );
+
+/// @brief Add numeric value setting to given change list
+/// @param[in] batch reference to internal change list
+/// @param[in] path path of the level/list to be changed, relative to batch data structure (key or index fields separated by ".", "" for data itself)
+/// @param[in] key string identifier of the field where the value will be placed/updated (NULL for appending to list)
+/// @param[in] value numeric value to be inserted/updated on given field
+/// @return true if change is stored successfully, false otherwise
+bool DataIO_BatchSetNumericValue( DataBatchHandle batch, const char* path, const char* key, const double value );
+
+/// @brief Add string value setting to given change list
+/// @param[in] batch reference to internal change list
+/// @param[in] path path of the level/list to be changed, relative to batch data structure (key or index fields separated by ".", "" for data itself)
+/// @param[in] key string identifier of the field where the value will be placed/updated (NULL for appending to list)
+/// @param[in] value string value to be inserted/updated on given field (copied)
+/// @return true if change is stored successfully, false otherwise
+bool DataIO_BatchSetStringValue( DataBatchHandle batch, const char* path, const char* key, const char* value );
+
+/// @brief Add boolean value setting to given change list
+/// @param[in] batch reference to internal change list
+/// @param[in] path path of the level/list to be changed, relative to batch data structure (key or index fields separated by ".", "" for data itself)
+/// @param[in] key string identifier of the field where the value will be placed/updated (NULL for appending to list)
+/// @param[in] value boolean value to be inserted/updated on given field
+/// @return true if change is stored successfully, false otherwise
+bool DataIO_BatchSetBooleanValue( DataBatchHandle batch, const char* path, const char* key, const bool value );
+
+/// @brief Add list insertion to given change list
+/// @param[in] batch reference to internal change list
+/// @param[in] path path of the level/list to be changed, relative to batch data structure (key or index fields separated by ".", "" for data itself)
+/// @param[in] key string identifier of the field where the list will be placed (NULL for appending to list)
+/// @return true if change is stored successfully, false otherwise
+bool DataIO_BatchAddList( DataBatchHandle batch, const char* path, const char* key );
+
+/// @brief Add nesting level insertion to given change list
+/// @param[in] batch reference to internal change list
+/// @param[in] path path of the level/list to be changed, relative to batch data structure (key or index fields separated by ".", "" for data itself)
+/// @param[in] key string identifier of the field where the nesting level will be added (NULL for appending to list)
+/// @return true if change is stored successfully, false otherwise
+bool DataIO_BatchAddLevel( DataBatchHandle batch, const char* path, const char* key );
+
+/// @brief Add field removal to given change list
+/// @param[in] batch reference to internal change list
+/// @param[in] path path of the level/list to be changed, relative to batch data structure (key or index fields separated by ".", "" for data itself)
+/// @param[in] key string identifier (or list index, in decimal form) of the field to be removed
+/// @return true if change is stored successfully, false otherwise
+bool DataIO_BatchRemoveKey( DataBatchHandle batch, const char* path, const char* key );
+
+/// @brief Apply all changes of given list at once, and destroy it (whether it succeeds or not)
+/// @param[in] batch reference to internal change list, invalid after the call in any case
+/// @return true if all changes are applied, false if none is (invalid path, bounded data full, etc.)
+/// @note concurrent readers of the batch data structure see either all the changes or none of them
+bool DataIO_CommitWriteBatch( DataBatchHandle batch );
+
+/// @brief Destroy given change list without applying it
+/// @param[in] batch reference to internal change list
+void DataIO_DiscardWriteBatch( DataBatchHandle batch );
+
 /// @brief Verify if specified value field/key is present inside given data strucuture
 /// @param[in] data reference to internal data structure where the key will be searched
 /// @param[in] pathFormat format string (like in printf) to key path inside the data structure (key or index fields separated by ".")
 /// @param[in] ... variable list of string keys or numeric indexes to build searched path from pathFormat (like in printf)
-/// @return true if key is found, false otherwise
+/// @return true if key is found (with value of any type), false otherwise
 bool DataIO_HasKey( DataHandle data, const char* pathFormat, ... );
 
+/// @brief Get reference to inner data level from given data strucuture (va_list version of DataIO_GetSubData)
+/// @param[in] data reference to internal data structure where the value will be searched
+/// @param[in] pathFormat format string (like in printf) to value path inside the data structure (key or index fields separated by ".")
+/// @param[in] pathArgs variable list of string keys or numeric indexes to build searched value path from pathFormat (like in vprintf)
+/// @return reference/pointer to internal data structure (NULL on errors)
+DataHandle DataIO_GetSubDataV( DataHandle data, const char* pathFormat, va_list pathArgs );
+
+/// @brief Get specified numeric value (floating point format) from given data strucuture (va_list version of DataIO_GetNumericValue)
+/// @param[in] data reference to internal data structure where the value will be searched
+/// @param[in] defaultValue value to be returned if specified field is not found
+/// @param[in] pathFormat format string (like in printf) to value path inside the data structure (key or index fields separated by ".")
+/// @param[in] pathArgs variable list of string keys or numeric indexes to build searched value path from pathFormat (like in vprintf)
+/// @return numeric value (floating point format) found or the default one
+double DataIO_GetNumericValueV( DataHandle data, const double defaultValue, const char* pathFormat, va_list pathArgs );
+
+/// @brief Get specified string value from given data strucuture (va_list version of DataIO_GetStringValue)
+/// @param[in] data reference to internal data structure where the value will be searched
+/// @param[in] defaultValue value to be returned if specified field is not found
+/// @param[in] pathFormat format string (like in printf) to value path inside the data structure (key or index fields separated by ".")
+/// @param[in] pathArgs variable list of string keys or numeric indexes to build searched value path from pathFormat (like in vprintf)
+/// @return string value found or the default one
+const char* DataIO_GetStringValueV( DataHandle data, const char* defaultValue, const char* pathFormat, va_list pathArgs );
+
+/// @brief Get specified boolean value from given data strucuture (va_list version of DataIO_GetBooleanValue)
+/// @param[in] data reference to internal data structure where the value will be searched
+/// @param[in] defaultValue value to be returned if specified field is not found
+/// @param[in] pathFormat format string (like in printf) to value path inside the data structure (key or index fields separated by ".")
+/// @param[in] pathArgs variable list of string keys or numeric indexes to build searched value path from pathFormat (like in vprintf)
+/// @return boolean value found or the default one
+bool DataIO_GetBooleanValueV( DataHandle data, const bool defaultValue, const char* pathFormat, va_list pathArgs );
+
+/// @brief Get number of elements for specified list from given data strucuture (va_list version of DataIO_GetListSize)
+/// @param[in] data reference to internal data structure where the list will be searched
+/// @param[in] pathFormat format string (like in printf) to list path inside the data structure (key or index fields separated by ".")
+/// @param[in] pathArgs variable list of string keys or numeric indexes to build searched list path from pathFormat (like in vprintf)
+/// @return number of elements of the list (or 0 if list is not found)
+size_t DataIO_GetListSizeV( DataHandle data, const char* pathFormat, va_list pathArgs );
+
+/// @brief Verify if specified value field/key is present inside given data strucuture (va_list version of DataIO_HasKey)
+/// @param[in] data reference to internal data structure where the key will be searched
+/// @param[in] pathFormat format string (like in printf) to key path inside the data structure (key or index fields separated by ".")
+/// @param[in] pathArgs variable list of string keys or numeric indexes to build searched path from pathFormat (like in vprintf)
+/// @return true if key is found, false otherwise
+bool DataIO_HasKeyV( DataHandle data, const char* pathFormat, va_list pathArgs );
+
+/// @brief Get reference to inner data level from given data strucuture, with no path formatting or length limit
+/// @param[in] data reference to internal data structure where the value will be searched
+/// @param[in] path value path inside the data structure (key or index fields separated by "."), not necessarily NUL-terminated
+/// @param[in] pathLength number of characters of the path
+/// @return reference/pointer to internal data structure (NULL on errors)
+DataHandle DataIO_GetSubDataN( DataHandle data, const char* path, size_t pathLength );
+
+/// @brief Get specified numeric value (floating point format) from given data strucuture, with no path formatting or length limit
+/// @param[in] data reference to internal data structure where the value will be searched
+/// @param[in] defaultValue value to be returned if specified field is not found
+/// @param[in] path value path inside the data structure (key or index fields separated by "."), not necessarily NUL-terminated
+/// @param[in] pathLength number of characters of the path
+/// @return numeric value (floating point format) found or the default one
+double DataIO_GetNumericValueN( DataHandle data, const double defaultValue, const char* path, size_t pathLength );
+
+/// @brief Get specified string value from given data strucuture, with no path formatting or length limit
+/// @param[in] data reference to internal data structure where the value will be searched
+/// @param[in] defaultValue value to be returned if specified field is not found
+/// @param[in] path value path inside the data structure (key or index fields separated by "."), not necessarily NUL-terminated
+/// @param[in] pathLength number of characters of the path
+/// @param[out] valueLength pointer to be filled with number of characters of returned string (may be NULL)
+/// @return string value found (internal reference, not truncated) or the default one
+const char* DataIO_GetStringValueN( DataHandle data, const char* defaultValue, const char* path, size_t pathLength, size_t* valueLength );
+
+/// @brief Get specified boolean value from given data strucuture, with no path formatting or length limit
+/// @param[in] data reference to internal data structure where the value will be searched
+/// @param[in] defaultValue value to be returned if specified field is not found
+/// @param[in] path value path inside the data structure (key or index fields separated by "."), not necessarily NUL-terminated
+/// @param[in] pathLength number of characters of the path
+/// @return boolean value found or the default one
+bool DataIO_GetBooleanValueN( DataHandle data, const bool defaultValue, const char* path, size_t pathLength );
+
+/// @brief Get number of elements for specified list from given data strucuture, with no path formatting or length limit
+/// @param[in] data reference to internal data structure where the list will be searched
+/// @param[in] path list path inside the data structure (key or index fields separated by "."), not necessarily NUL-terminated
+/// @param[in] pathLength number of characters of the path
+/// @return number of elements of the list (or 0 if list is not found)
+size_t DataIO_GetListSizeN( DataHandle data, const char* path, size_t pathLength );
+
+/// @brief Verify if specified value field/key is present inside given data strucuture, with no path formatting or length limit
+/// @param[in] data reference to internal data structure where the key will be searched
+/// @param[in] path key path inside the data structure (key or index fields separated by "."), not necessarily NUL-terminated
+/// @param[in] pathLength number of characters of the path
+/// @return true if key is found, false otherwise
+bool DataIO_HasKeyN( DataHandle data, const char* path, size_t pathLength );
+
+/// @brief Get direct access to specified all-numeric packed list from given data strucuture, with no path formatting or length limit
+/// @param[in] data reference to internal data structure where the list will be searched
+/// @param[out] listSize pointer to be filled with number of elements of the list (0 if not found/packed)
+/// @param[in] path list path inside the data structure (key or index fields separated by "."), not necessarily NUL-terminated
+/// @param[in] pathLength number of characters of the path
+/// @return internal read-only array of list values, valid until list is changed (NULL if list is not found or not packed)
+const double* DataIO_GetNumericArrayN( DataHandle data, size_t* listSize, const char* path, size_t pathLength );
+
+/// @brief Copy numeric values of specified list from given data strucuture to caller-provided array, with no path formatting or length limit
+/// @param[in] data reference to internal data structure where the list will be searched
+/// @param[out] valuesList array to be filled with list numeric values (NaN for non-numeric elements)
+/// @param[in] maxValuesCount maximum number of values to be copied
+/// @param[in] path list path inside the data structure (key or index fields separated by "."), not necessarily NUL-terminated
+/// @param[in] pathLength number of characters of the path
+/// @return number of values copied (0 if list is not found)
+size_t DataIO_CopyNumericListN( DataHandle data, double* valuesList, size_t maxValuesCount, const char* path, size_t pathLength );
+
+/// @brief Set numeric value (floating point format) for specified field of given data strucuture, with no key length limit
+/// @param[in] data reference to internal data structure where the value will be placed/updated
+/// @param[in] key string identifier of the field, not necessarily NUL-terminated (NULL for appending to list)
+/// @param[in] keyLength number of characters of the key
+/// @param[in] value numeric value to be inserted/updated on given data structure field
+/// @return true if value is inserted successfully, false otherwise
+bool DataIO_SetNumericValueN( DataHandle data, const char* key, size_t keyLength, const double value );
+
+/// @brief Set string value for specified field of given data strucuture, with no key or value length limit
+/// @param[in] data reference to internal data structure where the value will be placed/updated
+/// @param[in] key string identifier of the field, not necessarily NUL-terminated (NULL for appending to list)
+/// @param[in] keyLength number of characters of the key
+/// @param[in] value string value to be inserted/updated, not necessarily NUL-terminated
+/// @param[in] valueLength number of characters of the value
+/// @return true if value is inserted successfully, false otherwise
+bool DataIO_SetStringValueN( DataHandle data, const char* key, size_t keyLength, const char* value, size_t valueLength );
+
+/// @brief Set boolean value for specified field of given data strucuture, with no key length limit
+/// @param[in] data reference to internal data structure where the value will be placed/updated
+/// @param[in] key string identifier of the field, not necessarily NUL-terminated (NULL for appending to list)
+/// @param[in] keyLength number of characters of the key
+/// @param[in] value boolean value to be inserted/updated on given data structure field
+/// @return true if value is inserted successfully, false otherwise
+bool DataIO_SetBooleanValueN( DataHandle data, const char* key, size_t keyLength, const bool value );
+
+/// @brief Insert list on specified field of given data strucuture, with no key length limit
+/// @param[in] data reference to internal data structure where the list will be placed
+/// @param[in] key string identifier of the field, not necessarily NUL-terminated (NULL for appending to list)
+/// @param[in] keyLength number of characters of the key
+/// @return reference/pointer to newly created internal data structure, replacing any previous field value (NULL on errors)
+DataHandle DataIO_AddListN( DataHandle data, const char* key, size_t keyLength );
+
+/// @brief Insert nesting level on specified field of given data strucuture, with no key length limit
+/// @param[in] data reference to internal data structure where the nesting level will be added
+/// @param[in] key string identifier of the field, not necessarily NUL-terminated (NULL for appending to list)
+/// @param[in] keyLength number of characters of the key
+/// @return reference/pointer to newly created internal data structure, replacing any previous field value (NULL on errors)
+DataHandle DataIO_AddLevelN( DataHandle data, const char* key, size_t keyLength );
+
+/// @brief Get reference to inner data level from given data strucuture, following pre-split path
+/// @param[in] data reference to internal data structure where the value will be searched
+/// @param[in] segmentsList list of key/index segments of value path inside the data structure
+/// @param[in] segmentsCount number of path segments (0 for data itself)
+/// @return reference/pointer to internal data structure (NULL on errors)
+DataHandle DataIO_GetSubDataFromSegments( DataHandle data, const DataPathSegment* segmentsList, size_t segmentsCount );
+
+/// @brief Get specified numeric value (floating point format) from given data strucuture, following pre-split path
+/// @param[in] data reference to internal data structure where the value will be searched
+/// @param[in] defaultValue value to be returned if specified field is not found
+/// @param[in] segmentsList list of key/index segments of value path inside the data structure
+/// @param[in] segmentsCount number of path segments
+/// @return numeric value (floating point format) found or the default one
+double DataIO_GetNumericValueFromSegments( DataHandle data, const double defaultValue, const DataPathSegment* segmentsList, size_t segmentsCount );
+
+/// @brief Get specified string value from given data strucuture, following pre-split path
+/// @param[in] data reference to internal data structure where the value will be searched
+/// @param[in] defaultValue value to be returned if specified field is not found
+/// @param[in] segmentsList list of key/index segments of value path inside the data structure
+/// @param[in] segmentsCount number of path segments
+/// @param[out] valueLength pointer to be filled with number of characters of returned string (may be NULL)
+/// @return string value found or the default one
+const char* DataIO_GetStringValueFromSegments( DataHandle data, const char* defaultValue, const DataPathSegment* segmentsList, size_t segmentsCount, size_t* valueLength );
+
+/// @brief Get specified boolean value from given data strucuture, following pre-split path
+/// @param[in] data reference to internal data structure where the value will be searched
+/// @param[in] defaultValue value to be returned if specified field is not found
+/// @param[in] segmentsList list of key/index segments of value path inside the data structure
+/// @param[in] segmentsCount number of path segments
+/// @return boolean value found or the default one
+bool DataIO_GetBooleanValueFromSegments( DataHandle data, const bool defaultValue, const DataPathSegment* segmentsList, size_t segmentsCount );
+
+/// @brief Get number of elements for specified list from given data strucuture, following pre-split path
+/// @param[in] data reference to internal data structure where the list will be searched
+/// @param[in] segmentsList list of key/index segments of list path inside the data structure
+/// @param[in] segmentsCount number of path segments (0 for data itself)
+/// @return number of elements of the list (or 0 if list is not found)
+size_t DataIO_GetListSizeFromSegments( DataHandle data, const DataPathSegment* segmentsList, size_t segmentsCount );
+
+/// @brief Verify if specified value field/key is present inside given data strucuture, following pre-split path
+/// @param[in] data reference to internal data structure where the key will be searched
+/// @param[in] segmentsList list of key/index segments of key path inside the data structure
+/// @param[in] segmentsCount number of path segments
+/// @return true if key is found, false otherwise
+bool DataIO_HasKeyFromSegments( DataHandle data, const DataPathSegment* segmentsList, size_t segmentsCount );
+
+/// @brief Get direct access to specified all-numeric packed list from given data strucuture, following pre-split path
+/// @param[in] data reference to internal data structure where the list will be searched
+/// @param[out] listSize pointer to be filled with number of elements of the list (0 if not found/packed)
+/// @param[in] segmentsList list of key/index segments of list path inside the data structure
+/// @param[in] segmentsCount number of path segments (0 for data itself)
+/// @return internal read-only array of list values, valid until list is changed (NULL if list is not found or not packed)
+const double* DataIO_GetNumericArrayFromSegments( DataHandle data, size_t* listSize, const DataPathSegment* segmentsList, size_t segmentsCount );
+
+/// @brief Copy numeric values of specified list from given data strucuture to caller-provided array, following pre-split path
+/// @param[in] data reference to internal data structure where the list will be searched
+/// @param[out] valuesList array to be filled with list numeric values (NaN for non-numeric elements)
+/// @param[in] maxValuesCount maximum number of values to be copied
+/// @param[in] segmentsList list of key/index segments of list path inside the data structure
+/// @param[in] segmentsCount number of path segments (0 for data itself)
+/// @return number of values copied (0 if list is not found)
+size_t DataIO_CopyNumericListFromSegments( DataHandle data, double* valuesList, size_t maxValuesCount, const DataPathSegment* segmentsList, size_t segmentsCount );
+
+/// @brief Get many values from given data structure at once, walking shared path prefixes only once
+/// @param[in] data reference to internal data structure where the values will be searched
+/// @param[in] queriesList list of value requests (not changed: only the targets of their outValue pointers are written, with found or default values)
+/// @param[in] queriesCount number of value requests
+/// @return number of requested values found (the others get default values)
+size_t DataIO_GetMany( DataHandle data, const DataQuery* queriesList, size_t queriesCount );
+
+/// @brief Bind specified numeric field of given data structure to fixed slot, kept updated by DataIO_SetNumericValue (and similar) calls
+/// @param[in] data reference to internal data structure where the value will be searched
+/// @param[in] defaultValue value held by the slot while specified field is missing or not numeric
+/// @param[in] pathFormat format string (like in printf) to value path inside the data structure (key or index fields separated by ".")
+/// @param[in] ... variable list of string keys or numeric indexes to build searched value path from pathFormat (like in printf)
+/// @return reference to field value slot, valid until unbound or root data is unloaded (NULL on errors)
+/// @note binding the same field again returns the same slot
+DataNumericBinding DataIO_BindNumericValue( DataHandle data, const double defaultValue, const char* pathFormat, ... );
+
+/// @brief Bind specified boolean field of given data structure to fixed slot (value 1.0 for true, 0.0 for false), kept updated by DataIO_SetBooleanValue (and similar) calls
+/// @param[in] data reference to internal data structure where the value will be searched
+/// @param[in] defaultValue value held by the slot while specified field is missing or not boolean
+/// @param[in] pathFormat format string (like in printf) to value path inside the data structure (key or index fields separated by ".")
+/// @param[in] ... variable list of string keys or numeric indexes to build searched value path from pathFormat (like in printf)
+/// @return reference to field value slot, valid until unbound or root data is unloaded (NULL on errors)
+/// @note binding the same field again returns the same slot
+DataNumericBinding DataIO_BindBooleanValue( DataHandle data, const bool defaultValue, const char* pathFormat, ... );
+
+/// @brief Release slot of field bound with DataIO_BindNumericValue or DataIO_BindBooleanValue
+/// @param[in] data reference to internal data structure passed on binding
+/// @param[in] binding reference to field value slot
+void DataIO_UnbindNumericValue( DataHandle data, DataNumericBinding binding );
+
+/// @brief Get current value of bound numeric field, with no lookup or function call
+/// @param[in] binding reference to field value slot (not NULL)
+/// @return current numeric value (floating point format) of the field, or default one given on binding
+static inline double DataIO_GetBoundNumericValue( DataNumericBinding binding ) 
+{ 
+#if defined( __GNUC__ ) || defined( __clang__ )
+  double value;
+  __atomic_load( &(binding->value), &value, __ATOMIC_ACQUIRE );
+  return value;
+#else
+  return *((volatile const double*) &(binding->value));   // aligned 8-byte load, single access on supported platforms
+#endif
+}
+
+/// @brief Get current value of bound boolean field, with no lookup or function call
+/// @param[in] binding reference to field value slot (not NULL), from DataIO_BindBooleanValue
+/// @return current boolean value of the field, or default one given on binding
+static inline bool DataIO_GetBoundBooleanValue( DataNumericBinding binding ) { return ( DataIO_GetBoundNumericValue( binding ) > 0.5 ); }
+
+/// @brief Get change counter of bound field, with no lookup or function call
+/// @param[in] binding reference to field value slot (not NULL)
+/// @return number of field changes since binding (wrapping around)
+static inline uint32_t DataIO_GetBoundValueVersion( DataNumericBinding binding ) 
+{ 
+#if defined( __GNUC__ ) || defined( __clang__ )
+  return __atomic_load_n( &(binding->version), __ATOMIC_ACQUIRE );
+#else
+  return *((volatile const uint32_t*) &(binding->version));
+#endif
+}
+
+/// @brief Block calling thread until bound numeric/boolean field changes (no polling, e.g. futex wait on version counter)
+/// @param[in] binding reference to field value slot
+/// @param[in] lastVersion field version known by the caller (from DataIO_GetBoundValueVersion)
+/// @param[in] timeoutMs maximum time to wait, in milliseconds (negative for infinite)
+/// @return current field version (equal to lastVersion on timeout)
+uint32_t DataIO_WaitBoundValueChange( DataNumericBinding binding, uint32_t lastVersion, int timeoutMs );
+
+/// @brief Register function to be called when specified field (or any field inside it) is set, inserted or removed
+/// @param[in] data reference to internal data structure where the field will be watched
+/// @param[in] callback function called after each change
+/// @param[in] userData pointer passed to the callback
+/// @param[in] pathFormat format string (like in printf) to field path inside the data structure (key or index fields separated by ".")
+/// @param[in] ... variable list of string keys or numeric indexes to build watched path from pathFormat (like in printf)
+/// @return reference to callback registration (NULL on errors)
+DataWatchHandle DataIO_WatchValue( DataHandle data, DataChangeCallback callback, void* userData, const char* pathFormat, ... );
+
+/// @brief Remove field change callback registration
+/// @param[in] watch reference to callback registration (callback isn't running or called anymore after return)
+void DataIO_UnwatchValue( DataWatchHandle watch );
+
 #ifdef __cplusplus  
 }  // extern "C"  
 #endif
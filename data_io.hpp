@@ -0,0 +1,247 @@
+//////////////////////////////////////////////////////////////////////////////////
+//                                                                              //
+//  Copyright (c) 2016-2018 Leonardo Consoni <consoni_2519@hotmail.com>         //
+//                                                                              //
+//  This file is part of Data I/O Interface.                                    //
+//                                                                              //
+//  Data I/O Interface is free software: you can redistribute it and/or modify  //
+//  it under the terms of the GNU Lesser General Public License as published    //
+//  by the Free Software Foundation, either version 3 of the License, or        //
+//  (at your option) any later version.                                         //
+//                                                                              //
+//  Data I/O Interface is distributed in the hope that it will be useful,       //
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of              //
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                //
+//  GNU Lesser General Public License for more details.                         //
+//                                                                              //
+//  You should have received a copy of the GNU Lesser General Public License    //
+//  along with Data I/O Interface. If not, see <http://www.gnu.org/licenses/>.  //
+//                                                                              //
+//////////////////////////////////////////////////////////////////////////////////
+
+
+/// @file data_io.hpp
+/// @brief C++ (17 or later) wrapper types over data read/write functions
+///
+/// Header only, with no allocations of its own (besides buffer growth in Node::WriteTo): Document owns a data structure (unloaded on destruction), Node and Value are non-owning views.
+/// Errors follow the C interface: missing fields give empty nodes and default values
+/// Accessors use the length-aware (N) and pre-split path (FromSegments) functions: the dispatcher library emulates them through core ones
+/// for backends lacking them, but programs linked directly to an implementation require it to provide them
+
+#ifndef DATA_IO_HPP
+#define DATA_IO_HPP
+
+#include "data_io.h"
+
+#include <cstdlib>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace DataIO
+{
+  /// Non-owning view of contiguous values (like C++20 std::span)
+  template< typename T > class Span
+  {
+  public:
+    constexpr Span() noexcept = default;
+    constexpr Span( T* data, size_t size ) noexcept : data_( data ), size_( size ) {}
+    constexpr T* data() const noexcept { return data_; }
+    constexpr size_t size() const noexcept { return size_; }
+    constexpr bool empty() const noexcept { return ( size_ == 0 ); }
+    constexpr T* begin() const noexcept { return data_; }
+    constexpr T* end() const noexcept { return data_ + size_; }
+    constexpr T& operator[]( size_t index ) const noexcept { return data_[ index ]; }
+  private:
+    T* data_ = nullptr;
+    size_t size_ = 0;
+  };
+
+  /// Deleter of strings allocated by the C interface
+  struct StringDeleter { void operator()( char* string ) const noexcept { free( string ); } };
+  using DataString = std::unique_ptr<char, StringDeleter>;   ///< Owned serialized data string
+
+  class Node;
+
+  // Empty views may have null data, which the C interface takes as list append/index for keys (and may reject for string values)
+  inline const char* ViewData( std::string_view view ) noexcept { return ( view.data() != nullptr ) ? view.data() : ""; }
+
+  /// Non-owning view of one field (key or index) of a level/list, whatever its type
+  /// @note the key is referenced, not copied: its string must outlive the view (don't keep views made from temporary strings)
+  class Value
+  {
+  public:
+    Value( DataHandle parent, DataPathSegment segment ) noexcept : parent_( parent ), segment_( segment ) {}
+
+    /// @return inner level/list reference (empty node if field is missing or of other type)
+    inline Node AsNode() const noexcept;
+    /// @return numeric field value, or the default one
+    double AsNumber( double defaultValue = 0.0 ) const noexcept { return DataIO_GetNumericValueFromSegments( parent_, defaultValue, &segment_, 1 ); }
+    /// @return boolean field value, or the default one
+    bool AsBoolean( bool defaultValue = false ) const noexcept { return DataIO_GetBooleanValueFromSegments( parent_, defaultValue, &segment_, 1 ); }
+    /// @return string field value (internal reference), or the default one
+    std::string_view AsString( std::string_view defaultValue = {} ) const noexcept
+    {
+      size_t valueLength = 0;
+      const char* value = DataIO_GetStringValueFromSegments( parent_, nullptr, &segment_, 1, &valueLength );
+      return ( value != nullptr ) ? std::string_view( value, valueLength ) : defaultValue;
+    }
+    /// @return packed values of all-numeric list field (empty if missing or not packed)
+    Span<const double> AsNumbers() const noexcept
+    {
+      size_t listSize = 0;
+      const double* values = DataIO_GetNumericArrayFromSegments( parent_, &listSize, &segment_, 1 );
+      return ( values != nullptr ) ? Span<const double>( values, listSize ) : Span<const double>();
+    }
+    /// @return true if field is present (with value of any type)
+    bool Exists() const noexcept { return DataIO_HasKeyFromSegments( parent_, &segment_, 1 ); }
+
+    inline Value operator[]( std::string_view key ) const noexcept;
+    inline Value operator[]( size_t index ) const noexcept;
+
+  private:
+    DataHandle parent_;
+    DataPathSegment segment_;
+  };
+
+  /// Non-owning view of a level/list inside a data structure
+  class Node
+  {
+  public:
+    /// Iterator over list elements (input iterator, as dereferencing yields Value views by value)
+    class Iterator
+    {
+    public:
+      using iterator_category = std::input_iterator_tag;
+      using value_type = Value;
+      using difference_type = std::ptrdiff_t;
+      using pointer = void;
+      using reference = Value;
+
+      Iterator( DataHandle list, size_t index ) noexcept : list_( list ), index_( index ) {}
+      Value operator*() const noexcept { return Value( list_, DataPathSegment{ nullptr, 0, index_ } ); }
+      Iterator& operator++() noexcept { index_++; return *this; }
+      Iterator operator++( int ) noexcept { Iterator previous = *this; index_++; return previous; }
+      bool operator==( const Iterator& other ) const noexcept { return ( list_ == other.list_ && index_ == other.index_ ); }
+      bool operator!=( const Iterator& other ) const noexcept { return !( *this == other ); }
+    private:
+      DataHandle list_;
+      size_t index_;
+    };
+
+    Node() noexcept = default;
+    explicit Node( DataHandle data ) noexcept : data_( data ) {}
+
+    /// @return reference to internal data structure, for C interface calls
+    DataHandle Handle() const noexcept { return data_; }
+    explicit operator bool() const noexcept { return ( data_ != nullptr ); }
+
+    /// @return view of level field with given key (referencing, not copying, the key string)
+    Value operator[]( std::string_view key ) const noexcept { return Value( data_, DataPathSegment{ ViewData( key ), key.size(), 0 } ); }
+    /// @return view of list element at given index
+    Value operator[]( size_t index ) const noexcept { return Value( data_, DataPathSegment{ nullptr, 0, index } ); }
+
+    /// @return inner level/list at given path (key or index fields separated by "."), empty node if not found
+    Node GetNode( std::string_view path ) const noexcept { return Node( DataIO_GetSubDataN( data_, path.data(), path.size() ) ); }
+    /// @return numeric value at given path, or the default one
+    double GetNumber( std::string_view path, double defaultValue = 0.0 ) const noexcept { return DataIO_GetNumericValueN( data_, defaultValue, path.data(), path.size() ); }
+    /// @return boolean value at given path, or the default one
+    bool GetBoolean( std::string_view path, bool defaultValue = false ) const noexcept { return DataIO_GetBooleanValueN( data_, defaultValue, path.data(), path.size() ); }
+    /// @return string value at given path (internal reference), or the default one
+    std::string_view GetString( std::string_view path, std::string_view defaultValue = {} ) const noexcept
+    {
+      size_t valueLength = 0;
+      const char* value = DataIO_GetStringValueN( data_, nullptr, path.data(), path.size(), &valueLength );
+      return ( value != nullptr ) ? std::string_view( value, valueLength ) : defaultValue;
+    }
+    /// @return packed values of all-numeric list at given path (empty if not found or not packed)
+    Span<const double> GetNumbers( std::string_view path ) const noexcept
+    {
+      size_t listSize = 0;
+      const double* values = DataIO_GetNumericArrayN( data_, &listSize, path.data(), path.size() );
+      return ( values != nullptr ) ? Span<const double>( values, listSize ) : Span<const double>();
+    }
+    /// @return true if given path is present (with value of any type)
+    bool Has( std::string_view path ) const noexcept { return DataIO_HasKeyN( data_, path.data(), path.size() ); }
+
+    /// @return number of elements, if node is a list (0 otherwise)
+    size_t Size() const noexcept { return DataIO_GetListSizeN( data_, "", 0 ); }
+    Iterator begin() const noexcept { return Iterator( data_, 0 ); }
+    Iterator end() const noexcept { return Iterator( data_, Size() ); }
+
+    /// @return true if value is set on given key
+    bool SetNumber( std::string_view key, double value ) const noexcept { return DataIO_SetNumericValueN( data_, ViewData( key ), key.size(), value ); }
+    bool SetBoolean( std::string_view key, bool value ) const noexcept { return DataIO_SetBooleanValueN( data_, ViewData( key ), key.size(), value ); }
+    bool SetString( std::string_view key, std::string_view value ) const noexcept { return DataIO_SetStringValueN( data_, ViewData( key ), key.size(), ViewData( value ), value.size() ); }
+    /// @return true if value is appended, if node is a list
+    bool AppendNumber( double value ) const noexcept { return DataIO_SetNumericValueN( data_, nullptr, 0, value ); }
+    bool AppendBoolean( bool value ) const noexcept { return DataIO_SetBooleanValueN( data_, nullptr, 0, value ); }
+    bool AppendString( std::string_view value ) const noexcept { return DataIO_SetStringValueN( data_, nullptr, 0, ViewData( value ), value.size() ); }
+    /// @return newly inserted list/level (on given key, or appended to list), empty node on errors
+    Node AddList( std::string_view key ) const noexcept { return Node( DataIO_AddListN( data_, ViewData( key ), key.size() ) ); }
+    Node AddLevel( std::string_view key ) const noexcept { return Node( DataIO_AddLevelN( data_, ViewData( key ), key.size() ) ); }
+    Node AppendList() const noexcept { return Node( DataIO_AddListN( data_, nullptr, 0 ) ); }
+    Node AppendLevel() const noexcept { return Node( DataIO_AddLevelN( data_, nullptr, 0 ) ); }
+
+    /// @return newly allocated serialized string of node content (null on errors)
+    DataString ToString() const noexcept { return DataString( DataIO_GetDataString( data_ ) ); }
+    /// @brief Serialize node content into given string, reusing its memory (only grown when needed)
+    /// @return true on success
+    bool WriteTo( std::string& buffer ) const
+    {
+      size_t neededLength = 0;
+      buffer.resize( buffer.capacity() );
+      if( !DataIO_WriteDataToBuffer( data_, &buffer[ 0 ], buffer.size(), &neededLength ) )
+      {
+        buffer.resize( neededLength + 1 );
+        if( !DataIO_WriteDataToBuffer( data_, &buffer[ 0 ], buffer.size(), &neededLength ) )
+        {
+          buffer.clear();
+          return false;
+        }
+      }
+      buffer.resize( neededLength );
+      return true;
+    }
+
+  protected:
+    DataHandle data_ = nullptr;
+  };
+
+  Node Value::AsNode() const noexcept { return Node( DataIO_GetSubDataFromSegments( parent_, &segment_, 1 ) ); }
+  Value Value::operator[]( std::string_view key ) const noexcept { return AsNode()[ key ]; }
+  Value Value::operator[]( size_t index ) const noexcept { return AsNode()[ index ]; }
+
+  /// Owning (move-only) reference to root data structure, unloaded on destruction
+  class Document : public Node
+  {
+  public:
+    Document() noexcept = default;
+    /// @brief Take ownership of given root data structure
+    explicit Document( DataHandle data ) noexcept : Node( data ) {}
+    ~Document() { DataIO_UnloadData( data_ ); }
+
+    Document( const Document& ) = delete;
+    Document& operator=( const Document& ) = delete;
+    Document( Document&& other ) noexcept : Node( other.Release() ) {}
+    Document& operator=( Document&& other ) noexcept
+    {
+      if( this != &other ) { DataIO_UnloadData( data_ ); data_ = other.Release(); }
+      return *this;
+    }
+
+    /// @brief Give up ownership of the data structure, without unloading it
+    /// @return reference to internal data structure
+    DataHandle Release() noexcept { DataHandle data = data_; data_ = nullptr; return data; }
+
+    /// @return document with newly created empty data structure (empty on errors)
+    static Document Create() noexcept { return Document( DataIO_CreateEmptyData() ); }
+    /// @return document loaded from given storage path (empty on errors)
+    static Document Load( const char* storagePath ) noexcept { return Document( DataIO_LoadStorageData( storagePath ) ); }
+    /// @return document parsed from given string (empty on errors)
+    static Document Parse( std::string_view dataString ) noexcept { return Document( DataIO_LoadStringDataN( ViewData( dataString ), dataString.size() ) ); }
+  };
+}
+
+#endif // DATA_IO_HPP
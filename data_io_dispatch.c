@@ -0,0 +1,1120 @@
+//////////////////////////////////////////////////////////////////////////////////
+//                                                                              //
+//  Copyright (c) 2016-2018 Leonardo Consoni <consoni_2519@hotmail.com>         //
+//                                                                              //
+//  This file is part of Data I/O Interface.                                    //
+//                                                                              //
+//  Data I/O Interface is free software: you can redistribute it and/or modify  //
+//  it under the terms of the GNU Lesser General Public License as published    //
+//  by the Free Software Foundation, either version 3 of the License, or        //
+//  (at your option) any later version.                                         //
+//                                                                              //
+//  Data I/O Interface is distributed in the hope that it will be useful,       //
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of              //
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                //
+//  GNU Lesser General Public License for more details.                         //
+//                                                                              //
+//  You should have received a copy of the GNU Lesser General Public License    //
+//  along with Data I/O Interface. If not, see <http://www.gnu.org/licenses/>.  //
+//                                                                              //
+//////////////////////////////////////////////////////////////////////////////////
+
+
+/// @file data_io_dispatch.c
+/// @brief Dispatcher library forwarding interface calls to a backend loaded at runtime
+///
+/// Backend is chosen with DataIO_SelectBackend or, on first call, from DATA_IO_BACKEND_VARIABLE environment variable.
+/// Every interface function is exported: core ones are required from the backend, optional ones it lacks are emulated through
+/// core ones where possible (path variants, grouped reads, buffer serialization, error reporting) or else fail, reported once on stderr
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE   // for RTLD_DEEPBIND
+#endif
+
+#include "data_io.h"
+
+#include <dlfcn.h>
+#include <limits.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define PATH_BUFFER_LENGTH 256    // formatted paths/keys longer than that are built on heap memory
+
+// Interface function lists, as entries for which forwarders are generated:
+//   FUNCTION( returnType, name, failValue, parameters, arguments ) - returns failValue when missing, reported once
+//   EXACT( returnType, name, value, parameters, arguments )        - returns value when missing, the right answer for backends lacking the feature
+//   PROCEDURE( name, parameters, arguments )                       - does nothing when missing (only takes handles the backend couldn't create)
+// and CUSTOM( returnType, name, parameters ) entries, whose forwarders (with fallbacks on core functions) are written below
+#define CORE_FUNCTIONS( FUNCTION, EXACT, PROCEDURE, CUSTOM ) \
+  FUNCTION( DataHandle, CreateEmptyData, NULL, ( void ), () ) \
+  PROCEDURE( SetBaseStoragePath, ( const char* basePath ), ( basePath ) ) \
+  FUNCTION( const char**, ListStorageDataEntries, NULL, ( const char* storagePath ), ( storagePath ) ) \
+  PROCEDURE( UnloadData, ( DataHandle data ), ( data ) ) \
+  FUNCTION( char*, GetDataString, NULL, ( DataHandle data ), ( data ) ) \
+  FUNCTION( DataHandle, AddList, NULL, ( DataHandle data, const char* key ), ( data, key ) ) \
+  FUNCTION( DataHandle, AddLevel, NULL, ( DataHandle data, const char* key ), ( data, key ) ) \
+  FUNCTION( bool, SetNumericValue, false, ( DataHandle data, const char* key, const double value ), ( data, key, value ) ) \
+  FUNCTION( bool, SetStringValue, false, ( DataHandle data, const char* key, const char* value ), ( data, key, value ) ) \
+  FUNCTION( bool, SetBooleanValue, false, ( DataHandle data, const char* key, const bool value ), ( data, key, value ) ) \
+  CUSTOM( DataHandle, LoadStorageData, ( const char* ) ) \
+  CUSTOM( DataHandle, LoadStringData, ( const char* ) ) \
+  CUSTOM( DataHandle, GetSubData, ( DataHandle, const char*, ... ) ) \
+  CUSTOM( double, GetNumericValue, ( DataHandle, const double, const char*, ... ) ) \
+  CUSTOM( const char*, GetStringValue, ( DataHandle, const char*, const char*, ... ) ) \
+  CUSTOM( bool, GetBooleanValue, ( DataHandle, const bool, const char*, ... ) ) \
+  CUSTOM( size_t, GetListSize, ( DataHandle, const char*, ... ) ) \
+  CUSTOM( bool, HasKey, ( DataHandle, const char*, ... ) )
+
+#define OPTIONAL_FUNCTIONS( FUNCTION, EXACT, PROCEDURE, CUSTOM ) \
+  FUNCTION( DataHandle, CreateBoundedData, NULL, ( void* memoryBlock, size_t blockSize ), ( memoryBlock, blockSize ) ) \
+  EXACT( size_t, GetFreeCapacity, 0, ( DataHandle data ), ( data ) ) \
+  FUNCTION( DataPoolHandle, CreateDataPool, NULL, ( size_t maxIdleDataCount ), ( maxIdleDataCount ) ) \
+  FUNCTION( DataHandle, CreatePooledData, NULL, ( DataPoolHandle pool ), ( pool ) ) \
+  PROCEDURE( DestroyDataPool, ( DataPoolHandle pool ), ( pool ) ) \
+  EXACT( bool, SetConcurrencyMode, false, ( DataHandle data, DataConcurrencyMode mode ), ( data, mode ) ) \
+  FUNCTION( bool, LoadAllStorageEntries, false, ( DataHandle data ), ( data ) ) \
+  FUNCTION( DataFormat, GetStorageFormat, DATA_IO_FORMAT_UNKNOWN, ( const char* storagePath ), ( storagePath ) ) \
+  FUNCTION( bool, WriteStorageImage, false, ( DataHandle data, const char* storagePath ), ( data, storagePath ) ) \
+  EXACT( bool, IsReadOnlyData, false, ( DataHandle data ), ( data ) ) \
+  FUNCTION( DataServerHandle, StartStorageServer, NULL, ( const char* serverAddress, const char* storagePath ), ( serverAddress, storagePath ) ) \
+  FUNCTION( DataHandle, GetServedData, NULL, ( DataServerHandle server, const char* entryName ), ( server, entryName ) ) \
+  FUNCTION( size_t, PublishServedData, 0, ( DataServerHandle server ), ( server ) ) \
+  PROCEDURE( StopStorageServer, ( DataServerHandle server ), ( server ) ) \
+  FUNCTION( bool, SubscribeStorageData, false, ( DataHandle data, const char* pathPrefix ), ( data, pathPrefix ) ) \
+  PROCEDURE( UnsubscribeStorageData, ( DataHandle data, const char* pathPrefix ), ( data, pathPrefix ) ) \
+  FUNCTION( size_t, UpdateStorageData, 0, ( DataHandle data, int timeoutMs ), ( data, timeoutMs ) ) \
+  EXACT( bool, SetSerializationOptions, false, ( DataHandle data, int options ), ( data, options ) ) \
+  FUNCTION( bool, CompareData, false, ( DataHandle data, DataHandle otherData ), ( data, otherData ) ) \
+  FUNCTION( DataBatchHandle, CreateWriteBatch, NULL, ( DataHandle data ), ( data ) ) \
+  FUNCTION( bool, BatchSetNumericValue, false, ( DataBatchHandle batch, const char* path, const char* key, const double value ), ( batch, path, key, value ) ) \
+  FUNCTION( bool, BatchSetStringValue, false, ( DataBatchHandle batch, const char* path, const char* key, const char* value ), ( batch, path, key, value ) ) \
+  FUNCTION( bool, BatchSetBooleanValue, false, ( DataBatchHandle batch, const char* path, const char* key, const bool value ), ( batch, path, key, value ) ) \
+  FUNCTION( bool, BatchAddList, false, ( DataBatchHandle batch, const char* path, const char* key ), ( batch, path, key ) ) \
+  FUNCTION( bool, BatchAddLevel, false, ( DataBatchHandle batch, const char* path, const char* key ), ( batch, path, key ) ) \
+  FUNCTION( bool, BatchRemoveKey, false, ( DataBatchHandle batch, const char* path, const char* key ), ( batch, path, key ) ) \
+  FUNCTION( bool, CommitWriteBatch, false, ( DataBatchHandle batch ), ( batch ) ) \
+  PROCEDURE( DiscardWriteBatch, ( DataBatchHandle batch ), ( batch ) ) \
+  PROCEDURE( UnbindNumericValue, ( DataHandle data, DataNumericBinding binding ), ( data, binding ) ) \
+  FUNCTION( uint32_t, WaitBoundValueChange, lastVersion, ( DataNumericBinding binding, uint32_t lastVersion, int timeoutMs ), ( binding, lastVersion, timeoutMs ) ) \
+  PROCEDURE( UnwatchValue, ( DataWatchHandle watch ), ( watch ) ) \
+  CUSTOM( const DataError*, GetLastError, ( void ) ) \
+  CUSTOM( DataStorageEntry*, ListStorageEntriesInfo, ( const char*, const char*, size_t* ) ) \
+  CUSTOM( size_t, LoadStorageDataList, ( const char**, size_t, DataHandle* ) ) \
+  CUSTOM( DataHandle, LoadStringDataN, ( const char*, size_t ) ) \
+  CUSTOM( DataHandle, LoadFormattedStringData, ( const char*, DataFormat ) ) \
+  CUSTOM( char*, GetFormattedDataString, ( DataHandle, DataFormat ) ) \
+  CUSTOM( bool, WriteDataToBuffer, ( DataHandle, char*, size_t, size_t* ) ) \
+  CUSTOM( size_t, EstimateDataStringLength, ( DataHandle ) ) \
+  CUSTOM( DataHandle, GetSubDataN, ( DataHandle, const char*, size_t ) ) \
+  CUSTOM( double, GetNumericValueN, ( DataHandle, const double, const char*, size_t ) ) \
+  CUSTOM( const char*, GetStringValueN, ( DataHandle, const char*, const char*, size_t, size_t* ) ) \
+  CUSTOM( bool, GetBooleanValueN, ( DataHandle, const bool, const char*, size_t ) ) \
+  CUSTOM( size_t, GetListSizeN, ( DataHandle, const char*, size_t ) ) \
+  CUSTOM( bool, HasKeyN, ( DataHandle, const char*, size_t ) ) \
+  CUSTOM( const double*, GetNumericArrayN, ( DataHandle, size_t*, const char*, size_t ) ) \
+  CUSTOM( size_t, CopyNumericListN, ( DataHandle, double*, size_t, const char*, size_t ) ) \
+  CUSTOM( bool, SetNumericValueN, ( DataHandle, const char*, size_t, const double ) ) \
+  CUSTOM( bool, SetStringValueN, ( DataHandle, const char*, size_t, const char*, size_t ) ) \
+  CUSTOM( bool, SetBooleanValueN, ( DataHandle, const char*, size_t, const bool ) ) \
+  CUSTOM( DataHandle, AddListN, ( DataHandle, const char*, size_t ) ) \
+  CUSTOM( DataHandle, AddLevelN, ( DataHandle, const char*, size_t ) ) \
+  CUSTOM( DataHandle, GetSubDataFromSegments, ( DataHandle, const DataPathSegment*, size_t ) ) \
+  CUSTOM( double, GetNumericValueFromSegments, ( DataHandle, const double, const DataPathSegment*, size_t ) ) \
+  CUSTOM( const char*, GetStringValueFromSegments, ( DataHandle, const char*, const DataPathSegment*, size_t, size_t* ) ) \
+  CUSTOM( bool, GetBooleanValueFromSegments, ( DataHandle, const bool, const DataPathSegment*, size_t ) ) \
+  CUSTOM( size_t, GetListSizeFromSegments, ( DataHandle, const DataPathSegment*, size_t ) ) \
+  CUSTOM( bool, HasKeyFromSegments, ( DataHandle, const DataPathSegment*, size_t ) ) \
+  CUSTOM( const double*, GetNumericArrayFromSegments, ( DataHandle, size_t*, const DataPathSegment*, size_t ) ) \
+  CUSTOM( size_t, CopyNumericListFromSegments, ( DataHandle, double*, size_t, const DataPathSegment*, size_t ) ) \
+  CUSTOM( size_t, GetMany, ( DataHandle, const DataQuery*, size_t ) ) \
+  CUSTOM( DataHandle, GetSubDataV, ( DataHandle, const char*, va_list ) ) \
+  CUSTOM( double, GetNumericValueV, ( DataHandle, const double, const char*, va_list ) ) \
+  CUSTOM( const char*, GetStringValueV, ( DataHandle, const char*, const char*, va_list ) ) \
+  CUSTOM( bool, GetBooleanValueV, ( DataHandle, const bool, const char*, va_list ) ) \
+  CUSTOM( size_t, GetListSizeV, ( DataHandle, const char*, va_list ) ) \
+  CUSTOM( bool, HasKeyV, ( DataHandle, const char*, va_list ) ) \
+  CUSTOM( const double*, GetNumericArray, ( DataHandle, size_t*, const char*, ... ) ) \
+  CUSTOM( size_t, CopyNumericList, ( DataHandle, double*, size_t, const char*, ... ) ) \
+  CUSTOM( DataNumericBinding, BindNumericValue, ( DataHandle, const double, const char*, ... ) ) \
+  CUSTOM( DataNumericBinding, BindBooleanValue, ( DataHandle, const bool, const char*, ... ) ) \
+  CUSTOM( DataWatchHandle, WatchValue, ( DataHandle, DataChangeCallback, void*, const char*, ... ) )
+
+#define DECLARE_FUNCTION( type, name, failValue, parameters, arguments ) type (*name) parameters;
+#define DECLARE_PROCEDURE( name, parameters, arguments ) void (*name) parameters;
+#define DECLARE_CUSTOM( type, name, parameters ) type (*name) parameters;
+
+typedef struct _BackendInterface
+{
+  void* library;
+  CORE_FUNCTIONS( DECLARE_FUNCTION, DECLARE_FUNCTION, DECLARE_PROCEDURE, DECLARE_CUSTOM )
+  OPTIONAL_FUNCTIONS( DECLARE_FUNCTION, DECLARE_FUNCTION, DECLARE_PROCEDURE, DECLARE_CUSTOM )
+}
+BackendInterface;
+
+static BackendInterface backend = { NULL };
+static pthread_once_t defaultBackendLoad = PTHREAD_ONCE_INIT;
+
+// Assign through object pointer, as ISO C doesn't allow casting void* to function pointer
+#define LOAD_SYMBOL( interface, name ) ( *((void**) &(interface.name)) = dlsym( interface.library, "DataIO_" #name ) )
+#define LOAD_CORE_FUNCTION( type, name, ... ) if( LOAD_SYMBOL( newBackend, name ) == NULL ) isComplete = false;
+#define LOAD_CORE_PROCEDURE( name, ... ) if( LOAD_SYMBOL( newBackend, name ) == NULL ) isComplete = false;
+#define LOAD_OPTIONAL_FUNCTION( type, name, ... ) LOAD_SYMBOL( newBackend, name );
+#define LOAD_OPTIONAL_PROCEDURE( name, ... ) LOAD_SYMBOL( newBackend, name );
+
+static void LoadDefaultBackend( void )
+{
+  const char* libraryPath = getenv( DATA_IO_BACKEND_VARIABLE );
+  if( backend.library == NULL && libraryPath != NULL && libraryPath[ 0 ] != '\0' ) DataIO_SelectBackend( libraryPath );
+}
+
+// Verify if given backend function is available, loading default backend on first call
+#define HAS_FUNCTION( name ) ( pthread_once( &defaultBackendLoad, LoadDefaultBackend ) == 0 && backend.name != NULL )
+// Verify if any backend is loaded, after a HAS_FUNCTION check (core functions are then all available)
+#define HAS_BACKEND() ( backend.library != NULL )
+
+// Tell (once per function) that the loaded backend lacks an optional function with no fallback, whose calls then fail
+static void ReportMissing( int* isReported, const char* functionName )
+{
+  if( !HAS_BACKEND() ) return;
+#if defined(__GNUC__) || defined(__clang__)
+  if( __atomic_exchange_n( isReported, 1, __ATOMIC_RELAXED ) ) return;
+#else
+  if( *isReported ) return;
+  *isReported = 1;
+#endif
+  fprintf( stderr, "DataIO: backend lacks %s, calls to it fail\n", functionName );
+}
+#define REPORT_MISSING( name ) do { static int isReported = 0; ReportMissing( &isReported, "DataIO_" #name ); } while( 0 )
+
+#define FORWARD_FUNCTION( type, name, failValue, parameters, arguments ) \
+  type DataIO_##name parameters \
+  { \
+    if( HAS_FUNCTION( name ) ) return backend.name arguments; \
+    REPORT_MISSING( name ); \
+    return failValue; \
+  }
+#define FORWARD_EXACT( type, name, value, parameters, arguments ) \
+  type DataIO_##name parameters \
+  { \
+    if( !HAS_FUNCTION( name ) ) return value; \
+    return backend.name arguments; \
+  }
+#define FORWARD_PROCEDURE( name, parameters, arguments ) \
+  void DataIO_##name parameters \
+  { \
+    if( HAS_FUNCTION( name ) ) backend.name arguments; \
+  }
+#define SKIP_CUSTOM( type, name, parameters )
+
+// Paths given with length are passed to core functions as "%.*s" arguments
+#define PATH_ARGUMENTS( path, pathLength ) "%.*s", (int) (pathLength), ( (path) != NULL ) ? (path) : ""
+
+// Format variable arguments path into given buffer or, if it doesn't fit, into allocated memory (NULL on errors)
+static char* FormatPath( char* buffer, const char* pathFormat, va_list pathArgs )
+{
+  va_list argsCopy;
+  va_copy( argsCopy, pathArgs );
+  int pathLength = vsnprintf( buffer, PATH_BUFFER_LENGTH, pathFormat, argsCopy );
+  va_end( argsCopy );
+  if( pathLength < 0 ) return NULL;
+  if( pathLength < PATH_BUFFER_LENGTH ) return buffer;
+
+  char* path = (char*) malloc( (size_t) pathLength + 1 );
+  if( path == NULL ) return NULL;
+  vsnprintf( path, (size_t) pathLength + 1, pathFormat, pathArgs );
+
+  return path;
+}
+
+// Copy string with given length into given buffer or, if it doesn't fit, into allocated memory, NUL-terminated (NULL on errors)
+static char* CopyString( char* buffer, const char* string, size_t stringLength )
+{
+  char* stringCopy = ( stringLength < PATH_BUFFER_LENGTH ) ? buffer : (char*) malloc( stringLength + 1 );
+  if( stringCopy == NULL ) return NULL;
+  if( stringLength > 0 ) memcpy( stringCopy, string, stringLength );
+  stringCopy[ stringLength ] = '\0';
+
+  return stringCopy;
+}
+
+// Join pre-split path segments with "." into given buffer or, if it doesn't fit, into allocated memory
+// (NULL on errors and for keys containing ".", which can't be reached through core functions paths)
+static char* JoinSegments( char* buffer, const DataPathSegment* segmentsList, size_t segmentsCount, size_t* pathLength )
+{
+  char indexString[ 24 ];
+
+  *pathLength = 0;
+  for( size_t segmentIndex = 0; segmentIndex < segmentsCount; segmentIndex++ )
+  {
+    const DataPathSegment* segment = &(segmentsList[ segmentIndex ]);
+    if( segment->key != NULL && memchr( segment->key, '.', segment->keyLength ) != NULL ) return NULL;
+    if( segment->key != NULL ) *pathLength += segment->keyLength;
+    else *pathLength += (size_t) snprintf( indexString, sizeof(indexString), "%lu", (unsigned long) segment->index );
+    if( segmentIndex > 0 ) (*pathLength)++;
+  }
+
+  char* path = ( *pathLength < PATH_BUFFER_LENGTH ) ? buffer : (char*) malloc( *pathLength + 1 );
+  if( path == NULL ) return NULL;
+  char* pathEnd = path;
+  for( size_t segmentIndex = 0; segmentIndex < segmentsCount; segmentIndex++ )
+  {
+    const DataPathSegment* segment = &(segmentsList[ segmentIndex ]);
+    if( segmentIndex > 0 ) *(pathEnd++) = '.';
+    if( segment->key != NULL )
+    {
+      memcpy( pathEnd, segment->key, segment->keyLength );
+      pathEnd += segment->keyLength;
+    }
+    else pathEnd += sprintf( pathEnd, "%lu", (unsigned long) segment->index );
+  }
+  *pathEnd = '\0';
+
+  return path;
+}
+
+static inline void ReleasePath( char* path, char* buffer )
+{
+  if( path != buffer ) free( path );
+}
+
+// Copy list elements with core getters (NaN for non-numeric ones)
+static size_t CopyListValues( DataHandle list, double* valuesList, size_t maxValuesCount )
+{
+  if( list == NULL || !HAS_BACKEND() ) return 0;
+
+  size_t valuesCount = backend.GetListSize( list, "" );
+  if( valuesCount > maxValuesCount ) valuesCount = maxValuesCount;
+  for( size_t valueIndex = 0; valueIndex < valuesCount; valueIndex++ )
+    valuesList[ valueIndex ] = backend.GetNumericValue( list, NAN, "%lu", (unsigned long) valueIndex );
+
+  return valuesCount;
+}
+
+// Thread-local result of last loading, for backends lacking DataIO_GetLastError (failures with no location details)
+static pthread_key_t loadingErrorKey;
+static pthread_once_t loadingErrorKeyCreation = PTHREAD_ONCE_INIT;
+static const DataError UNDESCRIBED_ERROR = { NULL, 0, 0, 0, "loading failed (no details given by backend)" };
+
+static void ReleaseLoadingError( void* loadingError )
+{
+  if( loadingError != &UNDESCRIBED_ERROR ) free( loadingError );
+}
+
+static void CreateLoadingErrorKey( void )
+{
+  pthread_key_create( &loadingErrorKey, ReleaseLoadingError );
+}
+
+static void RecordLoading( const char* storagePath, bool isLoaded )
+{
+  if( backend.GetLastError != NULL ) return;
+
+  pthread_once( &loadingErrorKeyCreation, CreateLoadingErrorKey );
+  DataError* lastError = (DataError*) pthread_getspecific( loadingErrorKey );
+  if( lastError == NULL && isLoaded ) return;
+  ReleaseLoadingError( lastError );
+  lastError = NULL;
+
+  if( !isLoaded )
+  {
+    size_t pathSize = ( storagePath != NULL ) ? strlen( storagePath ) + 1 : 0;
+    lastError = (DataError*) malloc( sizeof(DataError) + pathSize );
+    if( lastError != NULL )
+    {
+      *lastError = UNDESCRIBED_ERROR;
+      if( storagePath != NULL ) lastError->storagePath = (const char*) memcpy( lastError + 1, storagePath, pathSize );
+    }
+    else lastError = (DataError*) &UNDESCRIBED_ERROR;
+  }
+  pthread_setspecific( loadingErrorKey, lastError );
+}
+
+#ifdef RTLD_DEEPBIND
+// Verify if malloc is replaced in global scope (glibc, where the original one is also exported as __libc_malloc)
+static bool IsAllocationInterposed( void )
+{
+  void* libcMalloc = dlsym( RTLD_DEFAULT, "__libc_malloc" );
+  return ( libcMalloc != NULL && dlsym( RTLD_DEFAULT, "malloc" ) != libcMalloc );
+}
+#endif
+
+bool DataIO_SelectBackend( const char* libraryPath )
+{
+  BackendInterface newBackend = { NULL };
+  bool isComplete = true;
+
+  if( libraryPath == NULL || libraryPath[ 0 ] == '\0' ) return false;   // dlopen would give the main program
+
+  int loadingFlags = RTLD_NOW | RTLD_LOCAL;
+#ifdef RTLD_DEEPBIND
+  // Keep backend internal calls bound to its own functions, not to the ones of this library, unless allocation
+  // functions are interposed (e.g. by sanitizers or allocation tracking), which deep binding would bypass
+  if( !IsAllocationInterposed() ) loadingFlags |= RTLD_DEEPBIND;
+#endif
+  newBackend.library = dlopen( libraryPath, loadingFlags );
+  if( newBackend.library == NULL )
+  {
+    fprintf( stderr, "DataIO: error loading backend: %s\n", dlerror() );
+    return false;
+  }
+
+  CORE_FUNCTIONS( LOAD_CORE_FUNCTION, LOAD_CORE_FUNCTION, LOAD_CORE_PROCEDURE, LOAD_CORE_FUNCTION )
+  OPTIONAL_FUNCTIONS( LOAD_OPTIONAL_FUNCTION, LOAD_OPTIONAL_FUNCTION, LOAD_OPTIONAL_PROCEDURE, LOAD_OPTIONAL_FUNCTION )
+
+  if( !isComplete )
+  {
+    fprintf( stderr, "DataIO: backend %s lacks core interface functions\n", libraryPath );
+    dlclose( newBackend.library );
+    return false;
+  }
+  // Forwarding to this library itself (e.g. given as backend) would never end
+  if( newBackend.CreateEmptyData == DataIO_CreateEmptyData )
+  {
+    fprintf( stderr, "DataIO: backend %s is the dispatcher library\n", libraryPath );
+    dlclose( newBackend.library );
+    return false;
+  }
+
+  if( backend.library != NULL ) dlclose( backend.library );
+  backend = newBackend;
+
+  return true;
+}
+
+void* DataIO_GetBackendFunction( const char* functionName )
+{
+  pthread_once( &defaultBackendLoad, LoadDefaultBackend );
+  if( backend.library == NULL || functionName == NULL ) return NULL;
+
+  return dlsym( backend.library, functionName );
+}
+
+CORE_FUNCTIONS( FORWARD_FUNCTION, FORWARD_EXACT, FORWARD_PROCEDURE, SKIP_CUSTOM )
+OPTIONAL_FUNCTIONS( FORWARD_FUNCTION, FORWARD_EXACT, FORWARD_PROCEDURE, SKIP_CUSTOM )
+
+// Loading
+
+DataHandle DataIO_LoadStorageData( const char* storagePath )
+{
+  if( !HAS_FUNCTION( LoadStorageData ) ) return NULL;
+
+  DataHandle data = backend.LoadStorageData( storagePath );
+  RecordLoading( storagePath, ( data != NULL ) );
+
+  return data;
+}
+
+DataHandle DataIO_LoadStringData( const char* dataString )
+{
+  if( !HAS_FUNCTION( LoadStringData ) ) return NULL;
+
+  DataHandle data = backend.LoadStringData( dataString );
+  RecordLoading( NULL, ( data != NULL ) );
+
+  return data;
+}
+
+DataHandle DataIO_LoadStringDataN( const char* dataString, size_t stringLength )
+{
+  if( HAS_FUNCTION( LoadStringDataN ) )
+  {
+    DataHandle data = backend.LoadStringDataN( dataString, stringLength );
+    RecordLoading( NULL, ( data != NULL ) );
+    return data;
+  }
+
+  // Terminated copy for core parser (with no stack buffer, as data strings are usually long)
+  char* stringCopy = (char*) malloc( stringLength + 1 );
+  if( stringCopy == NULL ) return NULL;
+  if( stringLength > 0 ) memcpy( stringCopy, dataString, stringLength );
+  stringCopy[ stringLength ] = '\0';
+  DataHandle data = DataIO_LoadStringData( stringCopy );
+  free( stringCopy );
+
+  return data;
+}
+
+DataHandle DataIO_LoadFormattedStringData( const char* dataString, DataFormat format )
+{
+  if( HAS_FUNCTION( LoadFormattedStringData ) )
+  {
+    DataHandle data = backend.LoadFormattedStringData( dataString, format );
+    RecordLoading( NULL, ( data != NULL ) );
+    return data;
+  }
+
+  // Core parser only takes native format (also tried for detection)
+  if( format == DATA_IO_FORMAT_DEFAULT || format == DATA_IO_FORMAT_AUTO ) return DataIO_LoadStringData( dataString );
+
+  REPORT_MISSING( LoadFormattedStringData );
+  if( HAS_BACKEND() ) RecordLoading( NULL, false );
+  return NULL;
+}
+
+size_t DataIO_LoadStorageDataList( const char** storagePathsList, size_t pathsCount, DataHandle* dataList )
+{
+  if( HAS_FUNCTION( LoadStorageDataList ) )
+  {
+    size_t loadedCount = backend.LoadStorageDataList( storagePathsList, pathsCount, dataList );
+    for( size_t pathIndex = 0; pathIndex < pathsCount; pathIndex++ )
+    {
+      if( dataList[ pathIndex ] == NULL ) RecordLoading( storagePathsList[ pathIndex ], false );
+    }
+    if( loadedCount == pathsCount ) RecordLoading( NULL, true );
+    return loadedCount;
+  }
+
+  size_t loadedCount = 0;
+  for( size_t pathIndex = 0; pathIndex < pathsCount; pathIndex++ )
+  {
+    dataList[ pathIndex ] = DataIO_LoadStorageData( storagePathsList[ pathIndex ] );
+    if( dataList[ pathIndex ] != NULL ) loadedCount++;
+  }
+
+  return loadedCount;
+}
+
+const DataError* DataIO_GetLastError( void )
+{
+  if( HAS_FUNCTION( GetLastError ) ) return backend.GetLastError();
+
+  pthread_once( &loadingErrorKeyCreation, CreateLoadingErrorKey );
+  return (const DataError*) pthread_getspecific( loadingErrorKey );
+}
+
+DataStorageEntry* DataIO_ListStorageEntriesInfo( const char* storagePath, const char* nameFilter, size_t* entriesCount )
+{
+  if( HAS_FUNCTION( ListStorageEntriesInfo ) ) return backend.ListStorageEntriesInfo( storagePath, nameFilter, entriesCount );
+
+  if( entriesCount != NULL ) *entriesCount = 0;
+  REPORT_MISSING( ListStorageEntriesInfo );
+  return NULL;
+}
+
+// Serialization
+
+char* DataIO_GetFormattedDataString( DataHandle data, DataFormat format )
+{
+  if( HAS_FUNCTION( GetFormattedDataString ) ) return backend.GetFormattedDataString( data, format );
+
+  if( format == DATA_IO_FORMAT_DEFAULT ) return DataIO_GetDataString( data );
+
+  REPORT_MISSING( GetFormattedDataString );
+  return NULL;
+}
+
+bool DataIO_WriteDataToBuffer( DataHandle data, char* buffer, size_t capacity, size_t* neededLength )
+{
+  if( HAS_FUNCTION( WriteDataToBuffer ) ) return backend.WriteDataToBuffer( data, buffer, capacity, neededLength );
+
+  if( neededLength != NULL ) *neededLength = 0;
+  char* dataString = DataIO_GetDataString( data );
+  if( dataString == NULL ) return false;
+
+  size_t stringLength = strlen( dataString );
+  if( neededLength != NULL ) *neededLength = stringLength;
+  bool isFitting = ( stringLength < capacity );
+  if( isFitting ) memcpy( buffer, dataString, stringLength + 1 );
+  free( dataString );
+
+  return isFitting;
+}
+
+size_t DataIO_EstimateDataStringLength( DataHandle data )
+{
+  if( HAS_FUNCTION( EstimateDataStringLength ) ) return backend.EstimateDataStringLength( data );
+
+  // Exact length, from actual serialization
+  char* dataString = DataIO_GetDataString( data );
+  if( dataString == NULL ) return 0;
+  size_t stringLength = strlen( dataString );
+  free( dataString );
+
+  return stringLength;
+}
+
+// Length-aware path functions: backend variant if available, otherwise core functions with "%.*s" path (or terminated key copies)
+
+DataHandle DataIO_GetSubDataN( DataHandle data, const char* path, size_t pathLength )
+{
+  if( HAS_FUNCTION( GetSubDataN ) ) return backend.GetSubDataN( data, path, pathLength );
+  if( !HAS_BACKEND() || pathLength > INT_MAX ) return NULL;
+
+  return backend.GetSubData( data, PATH_ARGUMENTS( path, pathLength ) );
+}
+
+double DataIO_GetNumericValueN( DataHandle data, const double defaultValue, const char* path, size_t pathLength )
+{
+  if( HAS_FUNCTION( GetNumericValueN ) ) return backend.GetNumericValueN( data, defaultValue, path, pathLength );
+  if( !HAS_BACKEND() || pathLength > INT_MAX ) return defaultValue;
+
+  return backend.GetNumericValue( data, defaultValue, PATH_ARGUMENTS( path, pathLength ) );
+}
+
+const char* DataIO_GetStringValueN( DataHandle data, const char* defaultValue, const char* path, size_t pathLength, size_t* valueLength )
+{
+  if( HAS_FUNCTION( GetStringValueN ) ) return backend.GetStringValueN( data, defaultValue, path, pathLength, valueLength );
+
+  const char* value = defaultValue;
+  if( HAS_BACKEND() && pathLength <= INT_MAX ) value = backend.GetStringValue( data, defaultValue, PATH_ARGUMENTS( path, pathLength ) );
+  if( valueLength != NULL ) *valueLength = ( value != NULL ) ? strlen( value ) : 0;
+
+  return value;
+}
+
+bool DataIO_GetBooleanValueN( DataHandle data, const bool defaultValue, const char* path, size_t pathLength )
+{
+  if( HAS_FUNCTION( GetBooleanValueN ) ) return backend.GetBooleanValueN( data, defaultValue, path, pathLength );
+  if( !HAS_BACKEND() || pathLength > INT_MAX ) return defaultValue;
+
+  return backend.GetBooleanValue( data, defaultValue, PATH_ARGUMENTS( path, pathLength ) );
+}
+
+size_t DataIO_GetListSizeN( DataHandle data, const char* path, size_t pathLength )
+{
+  if( HAS_FUNCTION( GetListSizeN ) ) return backend.GetListSizeN( data, path, pathLength );
+  if( !HAS_BACKEND() || pathLength > INT_MAX ) return 0;
+
+  return backend.GetListSize( data, PATH_ARGUMENTS( path, pathLength ) );
+}
+
+bool DataIO_HasKeyN( DataHandle data, const char* path, size_t pathLength )
+{
+  if( HAS_FUNCTION( HasKeyN ) ) return backend.HasKeyN( data, path, pathLength );
+  if( !HAS_BACKEND() || pathLength > INT_MAX ) return false;
+
+  return backend.HasKey( data, PATH_ARGUMENTS( path, pathLength ) );
+}
+
+const double* DataIO_GetNumericArrayN( DataHandle data, size_t* listSize, const char* path, size_t pathLength )
+{
+  if( HAS_FUNCTION( GetNumericArrayN ) ) return backend.GetNumericArrayN( data, listSize, path, pathLength );
+
+  if( listSize != NULL ) *listSize = 0;   // no packed lists with core functions only
+  return NULL;
+}
+
+size_t DataIO_CopyNumericListN( DataHandle data, double* valuesList, size_t maxValuesCount, const char* path, size_t pathLength )
+{
+  if( HAS_FUNCTION( CopyNumericListN ) ) return backend.CopyNumericListN( data, valuesList, maxValuesCount, path, pathLength );
+
+  return CopyListValues( DataIO_GetSubDataN( data, path, pathLength ), valuesList, maxValuesCount );
+}
+
+bool DataIO_SetNumericValueN( DataHandle data, const char* key, size_t keyLength, const double value )
+{
+  char keyBuffer[ PATH_BUFFER_LENGTH ];
+
+  if( HAS_FUNCTION( SetNumericValueN ) ) return backend.SetNumericValueN( data, key, keyLength, value );
+  if( !HAS_BACKEND() ) return false;
+  if( key == NULL ) return backend.SetNumericValue( data, NULL, value );
+
+  char* keyCopy = CopyString( keyBuffer, key, keyLength );
+  if( keyCopy == NULL ) return false;
+  bool isSet = backend.SetNumericValue( data, keyCopy, value );
+  ReleasePath( keyCopy, keyBuffer );
+
+  return isSet;
+}
+
+bool DataIO_SetStringValueN( DataHandle data, const char* key, size_t keyLength, const char* value, size_t valueLength )
+{
+  char keyBuffer[ PATH_BUFFER_LENGTH ], valueBuffer[ PATH_BUFFER_LENGTH ];
+
+  if( HAS_FUNCTION( SetStringValueN ) ) return backend.SetStringValueN( data, key, keyLength, value, valueLength );
+  if( !HAS_BACKEND() ) return false;
+
+  char* keyCopy = ( key != NULL ) ? CopyString( keyBuffer, key, keyLength ) : NULL;
+  char* valueCopy = CopyString( valueBuffer, value, valueLength );
+  bool isSet = false;
+  if( ( key == NULL || keyCopy != NULL ) && valueCopy != NULL ) isSet = backend.SetStringValue( data, keyCopy, valueCopy );
+  if( keyCopy != NULL ) ReleasePath( keyCopy, keyBuffer );
+  if( valueCopy != NULL ) ReleasePath( valueCopy, valueBuffer );
+
+  return isSet;
+}
+
+bool DataIO_SetBooleanValueN( DataHandle data, const char* key, size_t keyLength, const bool value )
+{
+  char keyBuffer[ PATH_BUFFER_LENGTH ];
+
+  if( HAS_FUNCTION( SetBooleanValueN ) ) return backend.SetBooleanValueN( data, key, keyLength, value );
+  if( !HAS_BACKEND() ) return false;
+  if( key == NULL ) return backend.SetBooleanValue( data, NULL, value );
+
+  char* keyCopy = CopyString( keyBuffer, key, keyLength );
+  if( keyCopy == NULL ) return false;
+  bool isSet = backend.SetBooleanValue( data, keyCopy, value );
+  ReleasePath( keyCopy, keyBuffer );
+
+  return isSet;
+}
+
+DataHandle DataIO_AddListN( DataHandle data, const char* key, size_t keyLength )
+{
+  char keyBuffer[ PATH_BUFFER_LENGTH ];
+
+  if( HAS_FUNCTION( AddListN ) ) return backend.AddListN( data, key, keyLength );
+  if( !HAS_BACKEND() ) return NULL;
+  if( key == NULL ) return backend.AddList( data, NULL );
+
+  char* keyCopy = CopyString( keyBuffer, key, keyLength );
+  if( keyCopy == NULL ) return NULL;
+  DataHandle list = backend.AddList( data, keyCopy );
+  ReleasePath( keyCopy, keyBuffer );
+
+  return list;
+}
+
+DataHandle DataIO_AddLevelN( DataHandle data, const char* key, size_t keyLength )
+{
+  char keyBuffer[ PATH_BUFFER_LENGTH ];
+
+  if( HAS_FUNCTION( AddLevelN ) ) return backend.AddLevelN( data, key, keyLength );
+  if( !HAS_BACKEND() ) return NULL;
+  if( key == NULL ) return backend.AddLevel( data, NULL );
+
+  char* keyCopy = CopyString( keyBuffer, key, keyLength );
+  if( keyCopy == NULL ) return NULL;
+  DataHandle level = backend.AddLevel( data, keyCopy );
+  ReleasePath( keyCopy, keyBuffer );
+
+  return level;
+}
+
+// Pre-split path functions: backend variant if available, otherwise length-aware functions with segments joined by "."
+
+DataHandle DataIO_GetSubDataFromSegments( DataHandle data, const DataPathSegment* segmentsList, size_t segmentsCount )
+{
+  char pathBuffer[ PATH_BUFFER_LENGTH ];
+  size_t pathLength;
+
+  if( HAS_FUNCTION( GetSubDataFromSegments ) ) return backend.GetSubDataFromSegments( data, segmentsList, segmentsCount );
+
+  char* path = JoinSegments( pathBuffer, segmentsList, segmentsCount, &pathLength );
+  if( path == NULL ) return NULL;
+  DataHandle subData = DataIO_GetSubDataN( data, path, pathLength );
+  ReleasePath( path, pathBuffer );
+
+  return subData;
+}
+
+double DataIO_GetNumericValueFromSegments( DataHandle data, const double defaultValue, const DataPathSegment* segmentsList, size_t segmentsCount )
+{
+  char pathBuffer[ PATH_BUFFER_LENGTH ];
+  size_t pathLength;
+
+  if( HAS_FUNCTION( GetNumericValueFromSegments ) ) return backend.GetNumericValueFromSegments( data, defaultValue, segmentsList, segmentsCount );
+
+  char* path = JoinSegments( pathBuffer, segmentsList, segmentsCount, &pathLength );
+  if( path == NULL ) return defaultValue;
+  double value = DataIO_GetNumericValueN( data, defaultValue, path, pathLength );
+  ReleasePath( path, pathBuffer );
+
+  return value;
+}
+
+const char* DataIO_GetStringValueFromSegments( DataHandle data, const char* defaultValue, const DataPathSegment* segmentsList, size_t segmentsCount, size_t* valueLength )
+{
+  char pathBuffer[ PATH_BUFFER_LENGTH ];
+  size_t pathLength;
+
+  if( HAS_FUNCTION( GetStringValueFromSegments ) ) return backend.GetStringValueFromSegments( data, defaultValue, segmentsList, segmentsCount, valueLength );
+
+  char* path = JoinSegments( pathBuffer, segmentsList, segmentsCount, &pathLength );
+  if( path == NULL )
+  {
+    if( valueLength != NULL ) *valueLength = ( defaultValue != NULL ) ? strlen( defaultValue ) : 0;
+    return defaultValue;
+  }
+  const char* value = DataIO_GetStringValueN( data, defaultValue, path, pathLength, valueLength );
+  ReleasePath( path, pathBuffer );
+
+  return value;
+}
+
+bool DataIO_GetBooleanValueFromSegments( DataHandle data, const bool defaultValue, const DataPathSegment* segmentsList, size_t segmentsCount )
+{
+  char pathBuffer[ PATH_BUFFER_LENGTH ];
+  size_t pathLength;
+
+  if( HAS_FUNCTION( GetBooleanValueFromSegments ) ) return backend.GetBooleanValueFromSegments( data, defaultValue, segmentsList, segmentsCount );
+
+  char* path = JoinSegments( pathBuffer, segmentsList, segmentsCount, &pathLength );
+  if( path == NULL ) return defaultValue;
+  bool value = DataIO_GetBooleanValueN( data, defaultValue, path, pathLength );
+  ReleasePath( path, pathBuffer );
+
+  return value;
+}
+
+size_t DataIO_GetListSizeFromSegments( DataHandle data, const DataPathSegment* segmentsList, size_t segmentsCount )
+{
+  char pathBuffer[ PATH_BUFFER_LENGTH ];
+  size_t pathLength;
+
+  if( HAS_FUNCTION( GetListSizeFromSegments ) ) return backend.GetListSizeFromSegments( data, segmentsList, segmentsCount );
+
+  char* path = JoinSegments( pathBuffer, segmentsList, segmentsCount, &pathLength );
+  if( path == NULL ) return 0;
+  size_t listSize = DataIO_GetListSizeN( data, path, pathLength );
+  ReleasePath( path, pathBuffer );
+
+  return listSize;
+}
+
+bool DataIO_HasKeyFromSegments( DataHandle data, const DataPathSegment* segmentsList, size_t segmentsCount )
+{
+  char pathBuffer[ PATH_BUFFER_LENGTH ];
+  size_t pathLength;
+
+  if( HAS_FUNCTION( HasKeyFromSegments ) ) return backend.HasKeyFromSegments( data, segmentsList, segmentsCount );
+
+  char* path = JoinSegments( pathBuffer, segmentsList, segmentsCount, &pathLength );
+  if( path == NULL ) return false;
+  bool hasKey = DataIO_HasKeyN( data, path, pathLength );
+  ReleasePath( path, pathBuffer );
+
+  return hasKey;
+}
+
+const double* DataIO_GetNumericArrayFromSegments( DataHandle data, size_t* listSize, const DataPathSegment* segmentsList, size_t segmentsCount )
+{
+  if( HAS_FUNCTION( GetNumericArrayFromSegments ) ) return backend.GetNumericArrayFromSegments( data, listSize, segmentsList, segmentsCount );
+
+  if( listSize != NULL ) *listSize = 0;   // no packed lists with core functions only
+  return NULL;
+}
+
+size_t DataIO_CopyNumericListFromSegments( DataHandle data, double* valuesList, size_t maxValuesCount, const DataPathSegment* segmentsList, size_t segmentsCount )
+{
+  if( HAS_FUNCTION( CopyNumericListFromSegments ) ) return backend.CopyNumericListFromSegments( data, valuesList, maxValuesCount, segmentsList, segmentsCount );
+
+  return CopyListValues( DataIO_GetSubDataFromSegments( data, segmentsList, segmentsCount ), valuesList, maxValuesCount );
+}
+
+// Grouped reading: backend function if available, otherwise one length-aware getter call per query
+
+static bool GetQueryValue( DataHandle data, const DataQuery* query )
+{
+  size_t pathLength = ( query->path != NULL ) ? strlen( query->path ) : 0;
+  bool isFound = false;
+
+  switch( query->type )
+  {
+    case DATA_IO_TYPE_NUMERIC:
+    {
+      // Found fields give the same value whatever the default (compared bitwise, for NaN)
+      double value = DataIO_GetNumericValueN( data, 0.0, query->path, pathLength );
+      double otherValue = DataIO_GetNumericValueN( data, 1.0, query->path, pathLength );
+      isFound = ( memcmp( &value, &otherValue, sizeof(double) ) == 0 );
+      if( query->outValue != NULL ) *((double*) query->outValue) = isFound ? value : query->defaultValue.number;
+      break;
+    }
+    case DATA_IO_TYPE_STRING:
+    {
+      const char* value = DataIO_GetStringValueN( data, NULL, query->path, pathLength, NULL );
+      isFound = ( value != NULL );
+      if( query->outValue != NULL ) *((const char**) query->outValue) = isFound ? value : query->defaultValue.string;
+      break;
+    }
+    case DATA_IO_TYPE_BOOLEAN:
+    {
+      bool value = DataIO_GetBooleanValueN( data, false, query->path, pathLength );
+      isFound = ( value == DataIO_GetBooleanValueN( data, true, query->path, pathLength ) );
+      if( query->outValue != NULL ) *((bool*) query->outValue) = isFound ? value : query->defaultValue.boolean;
+      break;
+    }
+    case DATA_IO_TYPE_LIST:
+    {
+      // Empty lists can't be told apart from levels through getters: counted as not found (with the same 0 output)
+      size_t listSize = DataIO_GetListSizeN( data, query->path, pathLength );
+      isFound = ( listSize > 0 );
+      if( query->outValue != NULL ) *((size_t*) query->outValue) = listSize;
+      break;
+    }
+    case DATA_IO_TYPE_LEVEL:
+    {
+      DataHandle subData = DataIO_GetSubDataN( data, query->path, pathLength );
+      isFound = ( subData != NULL );
+      if( query->outValue != NULL ) *((DataHandle*) query->outValue) = subData;
+      break;
+    }
+    default: break;
+  }
+
+  return isFound;
+}
+
+size_t DataIO_GetMany( DataHandle data, const DataQuery* queriesList, size_t queriesCount )
+{
+  if( HAS_FUNCTION( GetMany ) ) return backend.GetMany( data, queriesList, queriesCount );
+
+  size_t foundCount = 0;
+  for( size_t queryIndex = 0; queryIndex < queriesCount; queryIndex++ )
+  {
+    if( GetQueryValue( data, &(queriesList[ queryIndex ]) ) ) foundCount++;
+  }
+
+  return foundCount;
+}
+
+// Formatted path functions: va_list passed to backend variant if available, otherwise the path is formatted here (with no length limit)
+// and given to backend variadic function as "%s" argument
+
+DataHandle DataIO_GetSubDataV( DataHandle data, const char* pathFormat, va_list pathArgs )
+{
+  char pathBuffer[ PATH_BUFFER_LENGTH ];
+
+  if( HAS_FUNCTION( GetSubDataV ) ) return backend.GetSubDataV( data, pathFormat, pathArgs );
+  if( !HAS_FUNCTION( GetSubData ) ) return NULL;
+
+  char* path = FormatPath( pathBuffer, pathFormat, pathArgs );
+  if( path == NULL ) return NULL;
+  DataHandle subData = backend.GetSubData( data, "%s", path );
+  ReleasePath( path, pathBuffer );
+
+  return subData;
+}
+
+double DataIO_GetNumericValueV( DataHandle data, const double defaultValue, const char* pathFormat, va_list pathArgs )
+{
+  char pathBuffer[ PATH_BUFFER_LENGTH ];
+
+  if( HAS_FUNCTION( GetNumericValueV ) ) return backend.GetNumericValueV( data, defaultValue, pathFormat, pathArgs );
+  if( !HAS_FUNCTION( GetNumericValue ) ) return defaultValue;
+
+  char* path = FormatPath( pathBuffer, pathFormat, pathArgs );
+  if( path == NULL ) return defaultValue;
+  double value = backend.GetNumericValue( data, defaultValue, "%s", path );
+  ReleasePath( path, pathBuffer );
+
+  return value;
+}
+
+const char* DataIO_GetStringValueV( DataHandle data, const char* defaultValue, const char* pathFormat, va_list pathArgs )
+{
+  char pathBuffer[ PATH_BUFFER_LENGTH ];
+
+  if( HAS_FUNCTION( GetStringValueV ) ) return backend.GetStringValueV( data, defaultValue, pathFormat, pathArgs );
+  if( !HAS_FUNCTION( GetStringValue ) ) return defaultValue;
+
+  char* path = FormatPath( pathBuffer, pathFormat, pathArgs );
+  if( path == NULL ) return defaultValue;
+  const char* value = backend.GetStringValue( data, defaultValue, "%s", path );
+  ReleasePath( path, pathBuffer );
+
+  return value;
+}
+
+bool DataIO_GetBooleanValueV( DataHandle data, const bool defaultValue, const char* pathFormat, va_list pathArgs )
+{
+  char pathBuffer[ PATH_BUFFER_LENGTH ];
+
+  if( HAS_FUNCTION( GetBooleanValueV ) ) return backend.GetBooleanValueV( data, defaultValue, pathFormat, pathArgs );
+  if( !HAS_FUNCTION( GetBooleanValue ) ) return defaultValue;
+
+  char* path = FormatPath( pathBuffer, pathFormat, pathArgs );
+  if( path == NULL ) return defaultValue;
+  bool value = backend.GetBooleanValue( data, defaultValue, "%s", path );
+  ReleasePath( path, pathBuffer );
+
+  return value;
+}
+
+size_t DataIO_GetListSizeV( DataHandle data, const char* pathFormat, va_list pathArgs )
+{
+  char pathBuffer[ PATH_BUFFER_LENGTH ];
+
+  if( HAS_FUNCTION( GetListSizeV ) ) return backend.GetListSizeV( data, pathFormat, pathArgs );
+  if( !HAS_FUNCTION( GetListSize ) ) return 0;
+
+  char* path = FormatPath( pathBuffer, pathFormat, pathArgs );
+  if( path == NULL ) return 0;
+  size_t listSize = backend.GetListSize( data, "%s", path );
+  ReleasePath( path, pathBuffer );
+
+  return listSize;
+}
+
+bool DataIO_HasKeyV( DataHandle data, const char* pathFormat, va_list pathArgs )
+{
+  char pathBuffer[ PATH_BUFFER_LENGTH ];
+
+  if( HAS_FUNCTION( HasKeyV ) ) return backend.HasKeyV( data, pathFormat, pathArgs );
+  if( !HAS_FUNCTION( HasKey ) ) return false;
+
+  char* path = FormatPath( pathBuffer, pathFormat, pathArgs );
+  if( path == NULL ) return false;
+  bool hasKey = backend.HasKey( data, "%s", path );
+  ReleasePath( path, pathBuffer );
+
+  return hasKey;
+}
+
+DataHandle DataIO_GetSubData( DataHandle data, const char* pathFormat, ... )
+{
+  va_list pathArgs;
+  va_start( pathArgs, pathFormat );
+  DataHandle subData = DataIO_GetSubDataV( data, pathFormat, pathArgs );
+  va_end( pathArgs );
+
+  return subData;
+}
+
+double DataIO_GetNumericValue( DataHandle data, const double defaultValue, const char* pathFormat, ... )
+{
+  va_list pathArgs;
+  va_start( pathArgs, pathFormat );
+  double value = DataIO_GetNumericValueV( data, defaultValue, pathFormat, pathArgs );
+  va_end( pathArgs );
+
+  return value;
+}
+
+const char* DataIO_GetStringValue( DataHandle data, const char* defaultValue, const char* pathFormat, ... )
+{
+  va_list pathArgs;
+  va_start( pathArgs, pathFormat );
+  const char* value = DataIO_GetStringValueV( data, defaultValue, pathFormat, pathArgs );
+  va_end( pathArgs );
+
+  return value;
+}
+
+bool DataIO_GetBooleanValue( DataHandle data, const bool defaultValue, const char* pathFormat, ... )
+{
+  va_list pathArgs;
+  va_start( pathArgs, pathFormat );
+  bool value = DataIO_GetBooleanValueV( data, defaultValue, pathFormat, pathArgs );
+  va_end( pathArgs );
+
+  return value;
+}
+
+size_t DataIO_GetListSize( DataHandle data, const char* pathFormat, ... )
+{
+  va_list pathArgs;
+  va_start( pathArgs, pathFormat );
+  size_t listSize = DataIO_GetListSizeV( data, pathFormat, pathArgs );
+  va_end( pathArgs );
+
+  return listSize;
+}
+
+bool DataIO_HasKey( DataHandle data, const char* pathFormat, ... )
+{
+  va_list pathArgs;
+  va_start( pathArgs, pathFormat );
+  bool hasKey = DataIO_HasKeyV( data, pathFormat, pathArgs );
+  va_end( pathArgs );
+
+  return hasKey;
+}
+
+const double* DataIO_GetNumericArray( DataHandle data, size_t* listSize, const char* pathFormat, ... )
+{
+  char pathBuffer[ PATH_BUFFER_LENGTH ];
+  va_list pathArgs;
+
+  if( listSize != NULL ) *listSize = 0;
+  if( !HAS_FUNCTION( GetNumericArray ) ) return NULL;
+
+  va_start( pathArgs, pathFormat );
+  char* path = FormatPath( pathBuffer, pathFormat, pathArgs );
+  va_end( pathArgs );
+  if( path == NULL ) return NULL;
+  const double* valuesList = backend.GetNumericArray( data, listSize, "%s", path );
+  ReleasePath( path, pathBuffer );
+
+  return valuesList;
+}
+
+size_t DataIO_CopyNumericList( DataHandle data, double* valuesList, size_t maxValuesCount, const char* pathFormat, ... )
+{
+  char pathBuffer[ PATH_BUFFER_LENGTH ];
+  va_list pathArgs;
+
+  if( !HAS_FUNCTION( CopyNumericList ) )
+  {
+    va_start( pathArgs, pathFormat );
+    DataHandle list = DataIO_GetSubDataV( data, pathFormat, pathArgs );
+    va_end( pathArgs );
+    return CopyListValues( list, valuesList, maxValuesCount );
+  }
+
+  va_start( pathArgs, pathFormat );
+  char* path = FormatPath( pathBuffer, pathFormat, pathArgs );
+  va_end( pathArgs );
+  if( path == NULL ) return 0;
+  size_t valuesCount = backend.CopyNumericList( data, valuesList, maxValuesCount, "%s", path );
+  ReleasePath( path, pathBuffer );
+
+  return valuesCount;
+}
+
+DataNumericBinding DataIO_BindNumericValue( DataHandle data, const double defaultValue, const char* pathFormat, ... )
+{
+  char pathBuffer[ PATH_BUFFER_LENGTH ];
+  va_list pathArgs;
+
+  if( !HAS_FUNCTION( BindNumericValue ) )
+  {
+    REPORT_MISSING( BindNumericValue );
+    return NULL;
+  }
+
+  va_start( pathArgs, pathFormat );
+  char* path = FormatPath( pathBuffer, pathFormat, pathArgs );
+  va_end( pathArgs );
+  if( path == NULL ) return NULL;
+  DataNumericBinding binding = backend.BindNumericValue( data, defaultValue, "%s", path );
+  ReleasePath( path, pathBuffer );
+
+  return binding;
+}
+
+DataNumericBinding DataIO_BindBooleanValue( DataHandle data, const bool defaultValue, const char* pathFormat, ... )
+{
+  char pathBuffer[ PATH_BUFFER_LENGTH ];
+  va_list pathArgs;
+
+  if( !HAS_FUNCTION( BindBooleanValue ) )
+  {
+    REPORT_MISSING( BindBooleanValue );
+    return NULL;
+  }
+
+  va_start( pathArgs, pathFormat );
+  char* path = FormatPath( pathBuffer, pathFormat, pathArgs );
+  va_end( pathArgs );
+  if( path == NULL ) return NULL;
+  DataNumericBinding binding = backend.BindBooleanValue( data, defaultValue, "%s", path );
+  ReleasePath( path, pathBuffer );
+
+  return binding;
+}
+
+DataWatchHandle DataIO_WatchValue( DataHandle data, DataChangeCallback callback, void* userData, const char* pathFormat, ... )
+{
+  char pathBuffer[ PATH_BUFFER_LENGTH ];
+  va_list pathArgs;
+
+  if( !HAS_FUNCTION( WatchValue ) )
+  {
+    REPORT_MISSING( WatchValue );
+    return NULL;
+  }
+
+  va_start( pathArgs, pathFormat );
+  char* path = FormatPath( pathBuffer, pathFormat, pathArgs );
+  va_end( pathArgs );
+  if( path == NULL ) return NULL;
+  DataWatchHandle watch = backend.WatchValue( data, callback, userData, "%s", path );
+  ReleasePath( path, pathBuffer );
+
+  return watch;
+}
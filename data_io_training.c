@@ -0,0 +1,147 @@
+//////////////////////////////////////////////////////////////////////////////////
+//                                                                              //
+//  Copyright (c) 2016-2018 Leonardo Consoni <consoni_2519@hotmail.com>         //
+//                                                                              //
+//  This file is part of Data I/O Interface.                                    //
+//                                                                              //
+//  Data I/O Interface is free software: you can redistribute it and/or modify  //
+//  it under the terms of the GNU Lesser General Public License as published    //
+//  by the Free Software Foundation, either version 3 of the License, or        //
+//  (at your option) any later version.                                         //
+//                                                                              //
+//  Data I/O Interface is distributed in the hope that it will be useful,       //
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of              //
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                //
+//  GNU Lesser General Public License for more details.                         //
+//                                                                              //
+//  You should have received a copy of the GNU Lesser General Public License    //
+//  along with Data I/O Interface. If not, see <http://www.gnu.org/licenses/>.  //
+//                                                                              //
+//////////////////////////////////////////////////////////////////////////////////
+
+
+/// @file data_io_training.c
+/// @brief Representative workload for timing implementations and training profile-guided optimization
+///
+/// Usage: data_io_training [components_number] [iterations_number]
+/// Uses only core interface functions, so any implementation may be run (e.g. through dispatcher library)
+
+#define _POSIX_C_SOURCE 199309L   // for clock_gettime
+
+#include "data_io.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define DEFAULT_COMPONENTS_NUMBER 1000
+#define DEFAULT_ITERATIONS_NUMBER 20
+#define PARAMETERS_NUMBER 16
+#define SAMPLES_NUMBER 64
+#define KEY_LENGTH 32         // enough for generated keys and names
+
+static double GetTimeSeconds( void )
+{
+  struct timespec timeStamp;
+  clock_gettime( CLOCK_MONOTONIC, &timeStamp );
+  return (double) timeStamp.tv_sec + timeStamp.tv_nsec / 1e9;
+}
+
+// Build document similar to large configuration/calibration data: list of components with parameters and samples
+static DataHandle BuildDocument( size_t componentsNumber )
+{
+  char key[ KEY_LENGTH ];
+
+  DataHandle document = DataIO_CreateEmptyData();
+  DataHandle componentsList = DataIO_AddList( document, "components" );
+  if( componentsList == NULL ) return document;
+
+  for( size_t componentIndex = 0; componentIndex < componentsNumber; componentIndex++ )
+  {
+    DataHandle component = DataIO_AddLevel( componentsList, NULL );
+    snprintf( key, sizeof(key), "component_%lu", (unsigned long) componentIndex );
+    DataIO_SetStringValue( component, "name", key );
+    DataIO_SetBooleanValue( component, "enabled", ( componentIndex % 3 != 0 ) );
+    DataHandle parameters = DataIO_AddLevel( component, "parameters" );
+    for( size_t parameterIndex = 0; parameterIndex < PARAMETERS_NUMBER; parameterIndex++ )
+    {
+      snprintf( key, sizeof(key), "p%lu", (unsigned long) parameterIndex );
+      DataIO_SetNumericValue( parameters, key, componentIndex * 0.5 + parameterIndex );
+    }
+    DataHandle samplesList = DataIO_AddList( component, "samples" );
+    for( size_t sampleIndex = 0; sampleIndex < SAMPLES_NUMBER; sampleIndex++ )
+      DataIO_SetNumericValue( samplesList, NULL, (double) sampleIndex / SAMPLES_NUMBER );
+  }
+
+  return document;
+}
+
+// Read every parameter, flag and sample, like repeated configuration loading and control loops do
+static double ReadDocument( DataHandle document )
+{
+  double checksum = 0.0;
+
+  size_t componentsNumber = DataIO_GetListSize( document, "components" );
+  for( size_t componentIndex = 0; componentIndex < componentsNumber; componentIndex++ )
+  {
+    if( !DataIO_GetBooleanValue( document, false, "components.%lu.enabled", (unsigned long) componentIndex ) ) continue;
+    for( size_t parameterIndex = 0; parameterIndex < PARAMETERS_NUMBER; parameterIndex++ )
+      checksum += DataIO_GetNumericValue( document, 0.0, "components.%lu.parameters.p%lu", (unsigned long) componentIndex, (unsigned long) parameterIndex );
+    DataHandle samplesList = DataIO_GetSubData( document, "components.%lu.samples", (unsigned long) componentIndex );
+    size_t samplesNumber = DataIO_GetListSize( samplesList, "" );
+    for( size_t sampleIndex = 0; sampleIndex < samplesNumber; sampleIndex++ )
+      checksum += DataIO_GetNumericValue( samplesList, 0.0, "%lu", (unsigned long) sampleIndex );
+    if( DataIO_HasKey( document, "components.%lu.missing", (unsigned long) componentIndex ) ) checksum += 1.0;
+  }
+
+  return checksum;
+}
+
+int main( int argc, char* argv[] )
+{
+  size_t componentsNumber = ( argc > 1 ) ? (size_t) strtoul( argv[ 1 ], NULL, 10 ) : DEFAULT_COMPONENTS_NUMBER;
+  size_t iterationsNumber = ( argc > 2 ) ? (size_t) strtoul( argv[ 2 ], NULL, 10 ) : DEFAULT_ITERATIONS_NUMBER;
+  double buildTime = 0.0, loadTime = 0.0, readTime = 0.0, serializeTime = 0.0, checksum = 0.0;
+
+  for( size_t iteration = 0; iteration < iterationsNumber; iteration++ )
+  {
+    // Each phase is timed from a fresh time stamp, leaving out unloading and freeing between phases
+    double startTime = GetTimeSeconds();
+    DataHandle builtDocument = BuildDocument( componentsNumber );
+    double endTime = GetTimeSeconds();
+    buildTime += endTime - startTime;
+
+    startTime = GetTimeSeconds();
+    char* documentString = DataIO_GetDataString( builtDocument );
+    endTime = GetTimeSeconds();
+    serializeTime += endTime - startTime;
+    DataIO_UnloadData( builtDocument );
+    if( documentString == NULL )
+    {
+      fprintf( stderr, "data_io_training: document serialization failed\n" );
+      return EXIT_FAILURE;
+    }
+
+    startTime = GetTimeSeconds();
+    DataHandle loadedDocument = DataIO_LoadStringData( documentString );
+    endTime = GetTimeSeconds();
+    loadTime += endTime - startTime;
+    free( documentString );
+    if( loadedDocument == NULL )
+    {
+      fprintf( stderr, "data_io_training: document parsing failed\n" );
+      return EXIT_FAILURE;
+    }
+
+    startTime = GetTimeSeconds();
+    checksum += ReadDocument( loadedDocument );
+    readTime += GetTimeSeconds() - startTime;
+    DataIO_UnloadData( loadedDocument );
+  }
+
+  printf( "data_io_training: %lu components, %lu iterations (checksum %g)\n", (unsigned long) componentsNumber, (unsigned long) iterationsNumber, checksum );
+  printf( "build: %.6f s\nserialize: %.6f s\nload: %.6f s\nread: %.6f s\ntotal: %.6f s\n",
+          buildTime, serializeTime, loadTime, readTime, buildTime + serializeTime + loadTime + readTime );
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,184 @@
+//////////////////////////////////////////////////////////////////////////////////
+//                                                                              //
+//  Copyright (c) 2016-2018 Leonardo Consoni <consoni_2519@hotmail.com>         //
+//                                                                              //
+//  This file is part of Data I/O Interface.                                    //
+//                                                                              //
+//  Data I/O Interface is free software: you can redistribute it and/or modify  //
+//  it under the terms of the GNU Lesser General Public License as published    //
+//  by the Free Software Foundation, either version 3 of the License, or        //
+//  (at your option) any later version.                                         //
+//                                                                              //
+//  Data I/O Interface is distributed in the hope that it will be useful,       //
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of              //
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                //
+//  GNU Lesser General Public License for more details.                         //
+//                                                                              //
+//  You should have received a copy of the GNU Lesser General Public License    //
+//  along with Data I/O Interface. If not, see <http://www.gnu.org/licenses/>.  //
+//                                                                              //
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+/// @file data_io_bounded_noheap.c
+/// @brief Check that data created with DataIO_CreateBoundedData never allocates heap memory, even when full
+///
+/// Replaces the allocation functions of the process (glibc only) to count calls made during getter, setter and insertion
+/// calls on bounded data, which is then filled until setters fail, checking that the failure leaves data unchanged.
+/// Exits with 0 on success, 1 on failures and 77 (skipped) if not on glibc or no implementation with bounded data is set
+
+#define TEST_NAME "data_io_bounded_noheap"
+
+#include "data_io_test.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __GLIBC__
+
+#define BLOCK_SIZE ( 16 * 1024 )
+#define KEYS_NUMBER 32
+#define MAX_FILL_VALUES 1000000
+
+extern void* __libc_malloc( size_t size );
+extern void* __libc_calloc( size_t elementsCount, size_t elementSize );
+extern void* __libc_realloc( void* memory, size_t size );
+extern void* __libc_memalign( size_t alignment, size_t size );
+extern void __libc_free( void* memory );
+
+static volatile bool isCounting = false;
+static volatile size_t allocationsCount = 0, releasesCount = 0;
+
+void* malloc( size_t size )
+{
+  if( isCounting ) allocationsCount++;
+  return __libc_malloc( size );
+}
+
+void* calloc( size_t elementsCount, size_t elementSize )
+{
+  if( isCounting ) allocationsCount++;
+  return __libc_calloc( elementsCount, elementSize );
+}
+
+void* realloc( void* memory, size_t size )
+{
+  if( isCounting ) allocationsCount++;
+  return __libc_realloc( memory, size );
+}
+
+void* aligned_alloc( size_t alignment, size_t size )
+{
+  if( isCounting ) allocationsCount++;
+  return __libc_memalign( alignment, size );
+}
+
+int posix_memalign( void** memory, size_t alignment, size_t size )
+{
+  if( isCounting ) allocationsCount++;
+  *memory = __libc_memalign( alignment, size );
+  return ( *memory != NULL ) ? 0 : 12;   // ENOMEM
+}
+
+void free( void* memory )
+{
+  if( isCounting && memory != NULL ) releasesCount++;
+  __libc_free( memory );
+}
+
+// Caller-owned block, aligned for any value type
+static union { long double number; long long integer; void* pointer; char bytes[ BLOCK_SIZE ]; } memoryBlock;
+
+// Representative hot path: insertions, setters, getters and lookups on bounded data
+static void RunOperations( DataHandle data, char keysList[ KEYS_NUMBER ][ 16 ] )
+{
+  DataHandle level = DataIO_AddLevel( data, "level" );
+  DataHandle list = DataIO_AddList( data, "list" );
+  CHECK( level != NULL && list != NULL, "bounded operations" );
+  for( size_t keyIndex = 0; keyIndex < KEYS_NUMBER; keyIndex++ )
+  {
+    CHECK( DataIO_SetNumericValue( level, keysList[ keyIndex ], (double) keyIndex ), "bounded operations" );
+    CHECK( DataIO_SetNumericValue( list, NULL, (double) keyIndex ), "bounded operations" );
+  }
+  CHECK( DataIO_SetStringValue( data, "name", "bounded" ), "bounded operations" );
+  CHECK( DataIO_SetBooleanValue( data, "enabled", true ), "bounded operations" );
+  CHECK( DataIO_SetNumericValue( level, keysList[ 0 ], -1.0 ), "bounded operations" );   // replacing
+  CHECK( DataIO_AddLevel( list, NULL ) != NULL, "bounded operations" );
+
+  for( size_t keyIndex = 1; keyIndex < KEYS_NUMBER; keyIndex++ )
+  {
+    CHECK( DataIO_GetNumericValue( data, -1.0, "level.%s", keysList[ keyIndex ] ) == (double) keyIndex, "bounded operations" );
+    CHECK( DataIO_GetNumericValue( data, -1.0, "list.%lu", (unsigned long) keyIndex ) == (double) keyIndex, "bounded operations" );
+  }
+  CHECK( DataIO_GetNumericValue( data, 0.0, "level.%s", keysList[ 0 ] ) == -1.0, "bounded operations" );
+  CHECK( strcmp( DataIO_GetStringValue( data, "", "name" ), "bounded" ) == 0, "bounded operations" );
+  CHECK( DataIO_GetBooleanValue( data, false, "enabled" ), "bounded operations" );
+  CHECK( DataIO_GetListSize( data, "list" ) == KEYS_NUMBER + 1, "bounded operations" );
+  CHECK( DataIO_GetSubData( data, "level" ) == level, "bounded operations" );
+  CHECK( DataIO_HasKey( data, "level.%s", keysList[ 1 ] ) && !DataIO_HasKey( data, "missing" ), "bounded operations" );
+}
+
+// Append values until the block is full, then check that failing calls change nothing
+static void FillData( DataHandle data )
+{
+  DataHandle list = DataIO_AddList( data, "fill" );
+  CHECK( list != NULL, "full data" );
+
+  size_t valuesCount = 0;
+  while( valuesCount < MAX_FILL_VALUES && DataIO_SetNumericValue( list, NULL, (double) valuesCount ) )
+    valuesCount++;
+  CHECK( valuesCount < MAX_FILL_VALUES, "full data" );
+
+  size_t freeCapacity = DataIO_GetFreeCapacity( data );
+  CHECK( !DataIO_SetNumericValue( list, NULL, 0.0 ), "full data" );
+  CHECK( !DataIO_SetStringValue( data, "long_string_not_fitting", "string value longer than any leftover space should be" ), "full data" );
+  CHECK( DataIO_GetFreeCapacity( data ) == freeCapacity, "full data" );
+  CHECK( DataIO_GetListSize( list, "" ) == valuesCount, "full data" );
+  CHECK( !DataIO_HasKey( data, "long_string_not_fitting" ), "full data" );
+  if( valuesCount > 0 ) CHECK( DataIO_GetNumericValue( list, -1.0, "%lu", (unsigned long) ( valuesCount - 1 ) ) == (double) ( valuesCount - 1 ), "full data" );
+}
+
+int main( void )
+{
+  char keysList[ KEYS_NUMBER ][ 16 ];
+
+  // Loads backend, with any allocations of its own
+  RequireBackendFunction( "DataIO_CreateBoundedData", "bounded data" );
+
+  for( size_t keyIndex = 0; keyIndex < KEYS_NUMBER; keyIndex++ )
+    snprintf( keysList[ keyIndex ], sizeof(keysList[ keyIndex ]), "key_%lu", (unsigned long) keyIndex );
+
+  DataHandle data = DataIO_CreateBoundedData( &memoryBlock, sizeof(memoryBlock) );
+  if( data == NULL )
+  {
+    fprintf( stderr, "data_io_bounded_noheap: bounded data creation failed\n" );
+    return EXIT_FAILURE;
+  }
+
+  isCounting = true;
+  RunOperations( data, keysList );
+  FillData( data );
+  isCounting = false;
+  size_t freeCapacity = DataIO_GetFreeCapacity( data );
+  DataIO_UnloadData( data );
+
+  if( allocationsCount > 0 || releasesCount > 0 )
+    fprintf( stderr, "data_io_bounded_noheap: %lu heap allocations and %lu releases on bounded data\n", (unsigned long) allocationsCount, (unsigned long) releasesCount );
+  CHECK( allocationsCount == 0 && releasesCount == 0, "no heap use" );
+
+  char resultMessage[ 64 ];
+  snprintf( resultMessage, sizeof(resultMessage), "no heap use on bounded data (%lu free bytes left)", (unsigned long) freeCapacity );
+  return GetTestResult( resultMessage );
+}
+
+#else
+
+int main( void )
+{
+  printf( "data_io_bounded_noheap: allocation tracking only available with glibc, skipping\n" );
+  return TEST_SKIPPED;
+}
+
+#endif
@@ -0,0 +1,349 @@
+//////////////////////////////////////////////////////////////////////////////////
+//                                                                              //
+//  Copyright (c) 2016-2018 Leonardo Consoni <consoni_2519@hotmail.com>         //
+//                                                                              //
+//  This file is part of Data I/O Interface.                                    //
+//                                                                              //
+//  Data I/O Interface is free software: you can redistribute it and/or modify  //
+//  it under the terms of the GNU Lesser General Public License as published    //
+//  by the Free Software Foundation, either version 3 of the License, or        //
+//  (at your option) any later version.                                         //
+//                                                                              //
+//  Data I/O Interface is distributed in the hope that it will be useful,       //
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of              //
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                //
+//  GNU Lesser General Public License for more details.                         //
+//                                                                              //
+//  You should have received a copy of the GNU Lesser General Public License    //
+//  along with Data I/O Interface. If not, see <http://www.gnu.org/licenses/>.  //
+//                                                                              //
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+/// @file data_io_conformance.c
+/// @brief Conformance checks of the common behavior (see data_io.h) required from every implementation
+///
+/// Run through the dispatcher library, with the implementation chosen by DATA_IO_BACKEND_VARIABLE environment variable.
+/// Exits with 0 if every check passes, 1 otherwise and 77 (skipped) if no implementation is given
+
+#define TEST_NAME "data_io_conformance"
+
+#include "data_io_test.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static bool IsString( const char* value, const char* expectedValue )
+{
+  return ( value != NULL && strcmp( value, expectedValue ) == 0 );
+}
+
+static void CheckPaths( DataHandle data )
+{
+  CHECK( DataIO_GetNumericValue( data, 0.0, "level.x" ) == 2.0, "path" );
+  CHECK( DataIO_GetNumericValue( data, -1.0, "list.%u", 2 ) == 2.0, "path" );
+  DataHandle level = DataIO_GetSubData( data, "level" );
+  CHECK( level != NULL, "path" );
+  CHECK( DataIO_GetSubData( data, "" ) == data, "stable reference" );
+  CHECK( DataIO_GetSubData( level, "" ) == level, "stable reference" );
+  CHECK( DataIO_GetListSize( DataIO_GetSubData( data, "list" ), "" ) == 3, "empty path" );
+  CHECK( DataIO_GetNumericValue( level, 0.0, "x" ) == 2.0, "empty path" );
+}
+
+static void CheckNotFound( DataHandle data )
+{
+  CHECK( DataIO_GetNumericValue( data, 7.0, "missing" ) == 7.0, "missing field" );
+  CHECK( DataIO_GetNumericValue( data, 7.0, "level.missing" ) == 7.0, "missing field" );
+  CHECK( DataIO_GetNumericValue( data, 7.0, "missing.x" ) == 7.0, "missing field" );
+  CHECK( IsString( DataIO_GetStringValue( data, "default", "missing" ), "default" ), "missing field" );
+  CHECK( DataIO_GetBooleanValue( data, true, "missing" ) == true, "missing field" );
+  CHECK( DataIO_GetSubData( data, "missing" ) == NULL, "missing field" );
+  CHECK( DataIO_GetListSize( data, "missing" ) == 0, "missing field" );
+  CHECK( !DataIO_HasKey( data, "missing" ), "missing field" );
+
+  CHECK( DataIO_GetNumericValue( data, -1.0, "list.3" ) == -1.0, "out of range index" );
+  CHECK( DataIO_GetNumericValue( data, -1.0, "list.100" ) == -1.0, "out of range index" );
+  CHECK( !DataIO_HasKey( data, "list.3" ), "out of range index" );
+  CHECK( DataIO_HasKey( data, "list.2" ), "out of range index" );
+
+  CHECK( DataIO_GetNumericValue( data, 7.0, "text" ) == 7.0, "type mismatch" );
+  CHECK( DataIO_GetNumericValue( data, 7.0, "flag" ) == 7.0, "type mismatch" );
+  CHECK( DataIO_GetNumericValue( data, 7.0, "level" ) == 7.0, "type mismatch" );
+  CHECK( IsString( DataIO_GetStringValue( data, "default", "number" ), "default" ), "type mismatch" );
+  CHECK( DataIO_GetBooleanValue( data, false, "number" ) == false, "type mismatch" );
+  CHECK( DataIO_GetSubData( data, "number" ) == NULL, "type mismatch" );
+  CHECK( DataIO_GetListSize( data, "level" ) == 0, "type mismatch" );
+  CHECK( DataIO_GetNumericValue( data, 7.0, "number.x" ) == 7.0, "type mismatch" );
+  CHECK( DataIO_HasKey( data, "text" ) && DataIO_HasKey( data, "level" ), "type mismatch" );
+}
+
+// Results of every getter for one path, to compare path variants (N, FromSegments, V, GetMany) with formatted getters
+typedef struct PathValues {
+  DataHandle subData;
+  double number;
+  const char* string;
+  size_t stringLength;
+  bool booleanOrFalse, booleanOrTrue;
+  size_t listSize;
+  bool hasKey;
+} PathValues;
+
+#define NUMERIC_DEFAULT -1.5    // not held by any document field
+
+// Paths of every kind: found, out of range, missing and through fields of other types
+static const char* VARIANT_PATHS[] = { "", "number", "text", "flag", "level", "level.x", "list", "list.2", "list.3", "missing", "number.x", "level.x.y" };
+#define VARIANT_PATHS_NUMBER ( sizeof(VARIANT_PATHS) / sizeof(VARIANT_PATHS[ 0 ]) )
+
+static bool IsSameValues( const PathValues* values, const PathValues* otherValues )
+{
+  bool isSameString = ( values->string == NULL ) ? ( otherValues->string == NULL ) : IsString( otherValues->string, values->string );
+  return ( values->subData == otherValues->subData && memcmp( &(values->number), &(otherValues->number), sizeof(double) ) == 0
+           && isSameString && values->stringLength == otherValues->stringLength && values->booleanOrFalse == otherValues->booleanOrFalse
+           && values->booleanOrTrue == otherValues->booleanOrTrue && values->listSize == otherValues->listSize && values->hasKey == otherValues->hasKey );
+}
+
+static void GetFormattedValues( DataHandle data, const char* path, PathValues* values )
+{
+  values->subData = DataIO_GetSubData( data, "%s", path );
+  values->number = DataIO_GetNumericValue( data, NUMERIC_DEFAULT, "%s", path );
+  values->string = DataIO_GetStringValue( data, NULL, "%s", path );
+  values->stringLength = ( values->string != NULL ) ? strlen( values->string ) : 0;
+  values->booleanOrFalse = DataIO_GetBooleanValue( data, false, "%s", path );
+  values->booleanOrTrue = DataIO_GetBooleanValue( data, true, "%s", path );
+  values->listSize = DataIO_GetListSize( data, "%s", path );
+  values->hasKey = DataIO_HasKey( data, "%s", path );
+}
+
+// Path is given inside a longer string, to check that only pathLength characters are read
+static void GetLengthValues( DataHandle data, const char* path, PathValues* values )
+{
+  char pathBuffer[ 64 ];
+  size_t pathLength = strlen( path );
+  snprintf( pathBuffer, sizeof(pathBuffer), "%s.tail", path );
+
+  values->subData = DataIO_GetSubDataN( data, pathBuffer, pathLength );
+  values->number = DataIO_GetNumericValueN( data, NUMERIC_DEFAULT, pathBuffer, pathLength );
+  values->string = DataIO_GetStringValueN( data, NULL, pathBuffer, pathLength, &(values->stringLength) );
+  values->booleanOrFalse = DataIO_GetBooleanValueN( data, false, pathBuffer, pathLength );
+  values->booleanOrTrue = DataIO_GetBooleanValueN( data, true, pathBuffer, pathLength );
+  values->listSize = DataIO_GetListSizeN( data, pathBuffer, pathLength );
+  values->hasKey = DataIO_HasKeyN( data, pathBuffer, pathLength );
+}
+
+// Split path on "." into key segments, or index ones for all-digit fields
+static size_t SplitPath( const char* path, DataPathSegment* segmentsList, size_t maxSegmentsCount )
+{
+  size_t segmentsCount = 0;
+  while( *path != '\0' && segmentsCount < maxSegmentsCount )
+  {
+    size_t fieldLength = strcspn( path, "." );
+    DataPathSegment* segment = &(segmentsList[ segmentsCount++ ]);
+    bool isIndex = ( fieldLength > 0 && strspn( path, "0123456789" ) >= fieldLength );
+    segment->key = isIndex ? NULL : path;
+    segment->keyLength = isIndex ? 0 : fieldLength;
+    segment->index = isIndex ? (size_t) strtoul( path, NULL, 10 ) : 0;
+    path += ( path[ fieldLength ] == '.' ) ? fieldLength + 1 : fieldLength;
+  }
+  return segmentsCount;
+}
+
+static void GetSegmentsValues( DataHandle data, const char* path, PathValues* values )
+{
+  DataPathSegment segmentsList[ 4 ];
+  size_t segmentsCount = SplitPath( path, segmentsList, 4 );
+
+  values->subData = DataIO_GetSubDataFromSegments( data, segmentsList, segmentsCount );
+  values->number = DataIO_GetNumericValueFromSegments( data, NUMERIC_DEFAULT, segmentsList, segmentsCount );
+  values->string = DataIO_GetStringValueFromSegments( data, NULL, segmentsList, segmentsCount, &(values->stringLength) );
+  values->booleanOrFalse = DataIO_GetBooleanValueFromSegments( data, false, segmentsList, segmentsCount );
+  values->booleanOrTrue = DataIO_GetBooleanValueFromSegments( data, true, segmentsList, segmentsCount );
+  values->listSize = DataIO_GetListSizeFromSegments( data, segmentsList, segmentsCount );
+  values->hasKey = DataIO_HasKeyFromSegments( data, segmentsList, segmentsCount );
+}
+
+static void GetListValues( DataHandle data, PathValues* values, const char* pathFormat, ... )
+{
+  va_list pathArgs;
+
+  va_start( pathArgs, pathFormat );
+  values->subData = DataIO_GetSubDataV( data, pathFormat, pathArgs );
+  va_end( pathArgs );
+  va_start( pathArgs, pathFormat );
+  values->number = DataIO_GetNumericValueV( data, NUMERIC_DEFAULT, pathFormat, pathArgs );
+  va_end( pathArgs );
+  va_start( pathArgs, pathFormat );
+  values->string = DataIO_GetStringValueV( data, NULL, pathFormat, pathArgs );
+  values->stringLength = ( values->string != NULL ) ? strlen( values->string ) : 0;
+  va_end( pathArgs );
+  va_start( pathArgs, pathFormat );
+  values->booleanOrFalse = DataIO_GetBooleanValueV( data, false, pathFormat, pathArgs );
+  va_end( pathArgs );
+  va_start( pathArgs, pathFormat );
+  values->booleanOrTrue = DataIO_GetBooleanValueV( data, true, pathFormat, pathArgs );
+  va_end( pathArgs );
+  va_start( pathArgs, pathFormat );
+  values->listSize = DataIO_GetListSizeV( data, pathFormat, pathArgs );
+  va_end( pathArgs );
+  va_start( pathArgs, pathFormat );
+  values->hasKey = DataIO_HasKeyV( data, pathFormat, pathArgs );
+  va_end( pathArgs );
+}
+
+// Grouped reading gives no key presence (taken from formatted values), but must count found values like formatted getters tell
+static void GetGroupedValues( DataHandle data, const char* path, const PathValues* formattedValues, PathValues* values )
+{
+  DataQuery queriesList[] = {
+    { path, DATA_IO_TYPE_LEVEL, { .string = NULL }, &(values->subData) },
+    { path, DATA_IO_TYPE_NUMERIC, { .number = NUMERIC_DEFAULT }, &(values->number) },
+    { path, DATA_IO_TYPE_STRING, { .string = NULL }, &(values->string) },
+    { path, DATA_IO_TYPE_BOOLEAN, { .boolean = false }, &(values->booleanOrFalse) },
+    { path, DATA_IO_TYPE_BOOLEAN, { .boolean = true }, &(values->booleanOrTrue) },
+    { path, DATA_IO_TYPE_LIST, { .string = NULL }, &(values->listSize) }
+  };
+
+  size_t foundCount = DataIO_GetMany( data, queriesList, sizeof(queriesList) / sizeof(DataQuery) );
+  values->stringLength = ( values->string != NULL ) ? strlen( values->string ) : 0;
+  values->hasKey = formattedValues->hasKey;
+
+  // Found fields, for this document (whose lists aren't empty)
+  size_t expectedCount = ( formattedValues->subData != NULL ) + ( formattedValues->number != NUMERIC_DEFAULT ) + ( formattedValues->string != NULL )
+                         + 2 * ( formattedValues->booleanOrFalse == formattedValues->booleanOrTrue ) + ( formattedValues->listSize > 0 );
+  CHECK( foundCount == expectedCount, "grouped reading" );
+}
+
+static void CheckPathVariants( DataHandle data )
+{
+  PathValues formattedValues, values;
+
+  for( size_t pathIndex = 0; pathIndex < VARIANT_PATHS_NUMBER; pathIndex++ )
+  {
+    const char* path = VARIANT_PATHS[ pathIndex ];
+    GetFormattedValues( data, path, &formattedValues );
+    GetLengthValues( data, path, &values );
+    CHECK( IsSameValues( &formattedValues, &values ), "length-aware path" );
+    GetSegmentsValues( data, path, &values );
+    CHECK( IsSameValues( &formattedValues, &values ), "pre-split path" );
+    GetListValues( data, &values, "%s", path );
+    CHECK( IsSameValues( &formattedValues, &values ), "va_list path" );
+    GetGroupedValues( data, path, &formattedValues, &values );
+    CHECK( IsSameValues( &formattedValues, &values ), "grouped reading" );
+  }
+}
+
+static void CheckNullData( void )
+{
+  CHECK( DataIO_GetNumericValue( NULL, 7.0, "number" ) == 7.0, "NULL data" );
+  CHECK( IsString( DataIO_GetStringValue( NULL, "default", "text" ), "default" ), "NULL data" );
+  CHECK( DataIO_GetBooleanValue( NULL, true, "flag" ) == true, "NULL data" );
+  CHECK( DataIO_GetSubData( NULL, "level" ) == NULL, "NULL data" );
+  CHECK( DataIO_GetListSize( NULL, "list" ) == 0, "NULL data" );
+  CHECK( !DataIO_HasKey( NULL, "number" ), "NULL data" );
+  CHECK( !DataIO_SetNumericValue( NULL, "number", 1.0 ), "NULL data" );
+  CHECK( !DataIO_SetStringValue( NULL, "text", "value" ), "NULL data" );
+  CHECK( !DataIO_SetBooleanValue( NULL, "flag", true ), "NULL data" );
+  CHECK( DataIO_AddList( NULL, "list" ) == NULL, "NULL data" );
+  CHECK( DataIO_AddLevel( NULL, "level" ) == NULL, "NULL data" );
+  DataIO_UnloadData( NULL );
+}
+
+static void CheckReplacing( DataHandle data )
+{
+  CHECK( DataIO_SetStringValue( data, "number", "replaced" ), "replace on set" );
+  CHECK( IsString( DataIO_GetStringValue( data, NULL, "number" ), "replaced" ), "replace on set" );
+  CHECK( DataIO_GetNumericValue( data, 7.0, "number" ) == 7.0, "replace on set" );
+  CHECK( DataIO_SetNumericValue( data, "number", 3.0 ), "replace on set" );
+  CHECK( DataIO_GetNumericValue( data, 0.0, "number" ) == 3.0, "replace on set" );
+  CHECK( DataIO_SetBooleanValue( data, "level", false ), "replace on set" );
+  CHECK( DataIO_GetSubData( data, "level" ) == NULL && !DataIO_GetBooleanValue( data, true, "level" ), "replace on set" );
+  DataHandle level = DataIO_AddLevel( data, "list" );
+  CHECK( level != NULL && DataIO_GetListSize( data, "list" ) == 0, "replace on set" );
+  CHECK( DataIO_GetSubData( data, "list" ) == level, "stable reference" );
+}
+
+static void CheckAppending( DataHandle data )
+{
+  DataHandle list = DataIO_GetSubData( data, "list" );
+  CHECK( DataIO_SetNumericValue( list, NULL, 3.0 ), "NULL key append" );
+  CHECK( DataIO_SetStringValue( list, NULL, "four" ), "NULL key append" );
+  CHECK( DataIO_SetBooleanValue( list, NULL, true ), "NULL key append" );
+  CHECK( DataIO_AddLevel( list, NULL ) != NULL, "NULL key append" );
+  CHECK( DataIO_AddList( list, NULL ) != NULL, "NULL key append" );
+  CHECK( DataIO_GetListSize( data, "list" ) == 8, "NULL key append" );
+  CHECK( IsString( DataIO_GetStringValue( data, NULL, "list.4" ), "four" ), "NULL key append" );
+
+  DataHandle level = DataIO_GetSubData( data, "level" );
+  CHECK( !DataIO_SetNumericValue( level, NULL, 1.0 ), "NULL key append on level" );
+  CHECK( !DataIO_SetStringValue( level, NULL, "value" ), "NULL key append on level" );
+  CHECK( !DataIO_SetBooleanValue( level, NULL, true ), "NULL key append on level" );
+  CHECK( DataIO_AddList( level, NULL ) == NULL, "NULL key append on level" );
+  CHECK( DataIO_AddLevel( level, NULL ) == NULL, "NULL key append on level" );
+  CHECK( DataIO_AddList( data, NULL ) == NULL, "empty level root" );
+}
+
+static void CheckReferences( DataHandle data )
+{
+  char key[ 32 ];
+
+  const char* text = DataIO_GetStringValue( data, NULL, "text" );
+  DataHandle level = DataIO_GetSubData( data, "level" );
+  DataHandle list = DataIO_GetSubData( data, "list" );
+  // Unrelated changes, enough to grow internal storage
+  for( size_t index = 0; index < 1000; index++ )
+  {
+    snprintf( key, sizeof(key), "field_%lu", (unsigned long) index );
+    DataIO_SetNumericValue( data, key, (double) index );
+    DataIO_SetNumericValue( list, NULL, (double) index );
+  }
+  CHECK( IsString( text, "value" ), "reference lifetime" );
+  CHECK( DataIO_GetNumericValue( level, 0.0, "x" ) == 2.0, "reference lifetime" );
+  CHECK( DataIO_GetListSize( list, "" ) == 1003, "reference lifetime" );
+  CHECK( DataIO_GetSubData( data, "level" ) == level, "stable reference" );
+}
+
+static void CheckSerialization( DataHandle data )
+{
+  char* dataString = DataIO_GetDataString( data );
+  CHECK( dataString != NULL, "serialization" );
+  if( dataString == NULL ) return;
+  DataHandle loadedData = DataIO_LoadStringData( dataString );
+  free( dataString );
+  CHECK( loadedData != NULL, "serialization" );
+  CHECK( DataIO_GetNumericValue( loadedData, 0.0, "number" ) == 1.0, "serialization" );
+  CHECK( IsString( DataIO_GetStringValue( loadedData, NULL, "text" ), "value" ), "serialization" );
+  CHECK( DataIO_GetBooleanValue( loadedData, false, "flag" ) == true, "serialization" );
+  CHECK( DataIO_GetNumericValue( loadedData, 0.0, "level.x" ) == 2.0, "serialization" );
+  CHECK( DataIO_GetListSize( loadedData, "list" ) == 3, "serialization" );
+  CHECK( DataIO_GetNumericValue( loadedData, -1.0, "list.1" ) == 1.0, "serialization" );
+  DataIO_UnloadData( loadedData );
+}
+
+int main( void )
+{
+  RequireBackendFunction( "DataIO_CreateEmptyData", "core functions" );
+
+  DataHandle data = BuildSampleDocument();
+  if( data == NULL )
+  {
+    fprintf( stderr, "data_io_conformance: data creation failed\n" );
+    return EXIT_FAILURE;
+  }
+  CheckPaths( data );
+  CheckNotFound( data );
+  CheckPathVariants( data );
+  CheckNullData();
+  CheckSerialization( data );
+  CheckReferences( data );
+  DataIO_UnloadData( data );
+
+  data = BuildSampleDocument();
+  CheckReplacing( data );
+  DataIO_UnloadData( data );
+
+  data = BuildSampleDocument();
+  CheckAppending( data );
+  DataIO_UnloadData( data );
+
+  return GetTestResult( "all checks passed" );
+}
@@ -0,0 +1,135 @@
+//////////////////////////////////////////////////////////////////////////////////
+//                                                                              //
+//  Copyright (c) 2016-2018 Leonardo Consoni <consoni_2519@hotmail.com>         //
+//                                                                              //
+//  This file is part of Data I/O Interface.                                    //
+//                                                                              //
+//  Data I/O Interface is free software: you can redistribute it and/or modify  //
+//  it under the terms of the GNU Lesser General Public License as published    //
+//  by the Free Software Foundation, either version 3 of the License, or        //
+//  (at your option) any later version.                                         //
+//                                                                              //
+//  Data I/O Interface is distributed in the hope that it will be useful,       //
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of              //
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                //
+//  GNU Lesser General Public License for more details.                         //
+//                                                                              //
+//  You should have received a copy of the GNU Lesser General Public License    //
+//  along with Data I/O Interface. If not, see <http://www.gnu.org/licenses/>.  //
+//                                                                              //
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+/// @file data_io_cpp.cpp
+/// @brief Compilation (as C++17) and usage checks of the data_io.hpp wrapper types
+///
+/// Run through the dispatcher library, with the implementation chosen by DATA_IO_BACKEND_VARIABLE environment variable.
+/// Exits with 0 if every check passes, 1 otherwise and 77 (skipped) if no implementation is given
+
+#define TEST_NAME "data_io_cpp"
+
+#include "data_io.hpp"
+#include "data_io_test.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <utility>
+
+// Document { number: 1, text: "value", empty: "", level: { x: 2 }, list: [ 0, 1, 2, "" ] }, built through wrapper setters
+static DataIO::Document BuildDocument()
+{
+  DataIO::Document document = DataIO::Document::Create();
+  document.SetNumber( "number", 1.0 );
+  document.SetString( "text", "value" );
+  document.SetString( "empty", std::string_view() );   // null data view, sent as empty string
+  document.AddLevel( "level" ).SetNumber( "x", 2.0 );
+  DataIO::Node list = document.AddList( "list" );
+  for( size_t index = 0; index < 3; index++ )
+    list.AppendNumber( (double) index );
+  list.AppendString( std::string_view() );
+  return document;
+}
+
+static void CheckAccess( const DataIO::Node& root )
+{
+  CHECK( root.GetNumber( "number" ) == 1.0, "access" );
+  CHECK( root.GetString( "text" ) == "value", "access" );
+  CHECK( root.Has( "empty" ) && root.GetString( "empty", "default" ).empty(), "access" );
+  CHECK( root.GetNumber( "level.x" ) == 2.0, "access" );
+  CHECK( root.GetNumber( "missing", -1.0 ) == -1.0, "access" );
+  CHECK( !root.GetNode( "missing" ), "access" );
+
+  // Paths given by views of larger strings use only the viewed part
+  std::string_view path( "level.x.tail", 7 );
+  CHECK( root.GetNumber( path ) == 2.0, "access" );
+
+  CHECK( root[ "level" ][ "x" ].AsNumber() == 2.0, "access" );
+  CHECK( root[ "text" ].AsString() == "value", "access" );
+  CHECK( root[ "list" ][ (size_t) 3 ].Exists() && root[ "list" ][ (size_t) 3 ].AsString( "default" ).empty(), "access" );
+  CHECK( !root[ "missing" ].Exists() && root[ "missing" ].AsBoolean( true ), "access" );
+
+  DataIO::Node list = root.GetNode( "list" );
+  CHECK( list.Size() == 4, "access" );
+  double valuesSum = 0.0;
+  size_t valuesCount = 0;
+  for( DataIO::Value value : list )
+  {
+    valuesSum += value.AsNumber();
+    valuesCount++;
+  }
+  CHECK( valuesCount == 4 && valuesSum == 3.0, "access" );
+}
+
+// Serialized strings are compared by loaded content, as serialization needn't be deterministic
+static bool IsParsedDocument( std::string_view dataString )
+{
+  DataIO::Document parsed = DataIO::Document::Parse( dataString );
+  return ( parsed && parsed.GetNumber( "level.x" ) == 2.0 && parsed.GetString( "text" ) == "value" && parsed.GetNode( "list" ).Size() == 4 );
+}
+
+static void CheckSerialization( const DataIO::Node& root )
+{
+  DataIO::DataString dataString = root.ToString();
+  CHECK( dataString != nullptr && IsParsedDocument( dataString.get() ), "serialization" );
+
+  std::string buffer;
+  CHECK( root.WriteTo( buffer ) && IsParsedDocument( buffer ), "serialization" );
+  // Reused buffer is resized to the new content
+  CHECK( root.WriteTo( buffer ) && IsParsedDocument( buffer ), "serialization" );
+  CHECK( !IsParsedDocument( std::string_view() ), "serialization" );
+}
+
+static void CheckOwnership()
+{
+  DataIO::Document document = BuildDocument();
+  DataHandle data = document.Handle();
+
+  DataIO::Document movedDocument( std::move( document ) );
+  CHECK( !document && movedDocument.Handle() == data, "ownership" );
+  document = std::move( movedDocument );
+  CHECK( document.Handle() == data && !movedDocument, "ownership" );
+
+  DataHandle releasedData = document.Release();
+  CHECK( releasedData == data && !document, "ownership" );
+  DataIO_UnloadData( releasedData );
+}
+
+int main()
+{
+  RequireBackendFunction( "DataIO_CreateEmptyData", "core functions" );
+
+  DataIO::Document document = BuildDocument();
+  if( !document )
+  {
+    fprintf( stderr, "data_io_cpp: data creation failed\n" );
+    return EXIT_FAILURE;
+  }
+  CheckAccess( document );
+  CheckSerialization( document );
+  CheckOwnership();
+
+  return GetTestResult( "all checks passed" );
+}
@@ -0,0 +1,117 @@
+//////////////////////////////////////////////////////////////////////////////////
+//                                                                              //
+//  Copyright (c) 2016-2018 Leonardo Consoni <consoni_2519@hotmail.com>         //
+//                                                                              //
+//  This file is part of Data I/O Interface.                                    //
+//                                                                              //
+//  Data I/O Interface is free software: you can redistribute it and/or modify  //
+//  it under the terms of the GNU Lesser General Public License as published    //
+//  by the Free Software Foundation, either version 3 of the License, or        //
+//  (at your option) any later version.                                         //
+//                                                                              //
+//  Data I/O Interface is distributed in the hope that it will be useful,       //
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of              //
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                //
+//  GNU Lesser General Public License for more details.                         //
+//                                                                              //
+//  You should have received a copy of the GNU Lesser General Public License    //
+//  along with Data I/O Interface. If not, see <http://www.gnu.org/licenses/>.  //
+//                                                                              //
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+/// @file data_io_fuzz.c
+/// @brief Fuzz target for string parsing and serialization: load -> serialize -> load -> compare
+///
+/// Built for libFuzzer (Clang -fsanitize=fuzzer) or, with DATA_IO_FUZZ_STANDALONE defined, as a program running the
+/// target over each file given as argument (e.g. to replay crashes or AFL outputs). Runs through the dispatcher library,
+/// over the implementation in DATA_IO_BACKEND_VARIABLE, which should be built with -fsanitize=fuzzer-no-link for coverage.
+/// Any input that loads must serialize to a string loading to equal data, otherwise the target aborts (as it does on start with no implementation)
+
+#include "data_io.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+int LLVMFuzzerInitialize( int* argc, char*** argv );
+int LLVMFuzzerTestOneInput( const uint8_t* input, size_t inputLength );
+
+static bool hasComparison = false;
+
+// Check the backend once, before any input: fuzzing with none loaded would only exercise dispatcher defaults
+int LLVMFuzzerInitialize( int* argc, char*** argv )
+{
+  (void) argc;
+  (void) argv;
+
+  if( DataIO_GetBackendFunction( "DataIO_LoadStringData" ) == NULL )
+  {
+    fprintf( stderr, "data_io_fuzz: no implementation loaded from " DATA_IO_BACKEND_VARIABLE "\n" );
+    abort();
+  }
+  hasComparison = ( DataIO_GetBackendFunction( "DataIO_CompareData" ) != NULL );
+  if( !hasComparison ) fprintf( stderr, "data_io_fuzz: implementation lacks DataIO_CompareData, only checking that serialized data loads back\n" );
+
+  return 0;
+}
+
+int LLVMFuzzerTestOneInput( const uint8_t* input, size_t inputLength )
+{
+  // Length-aware parser must not read beyond given length (no terminator is added; the dispatcher
+  // passes a terminated copy to implementations lacking it)
+  DataHandle data = DataIO_LoadStringDataN( (const char*) input, inputLength );
+  if( data == NULL ) return 0;
+
+  char* dataString = DataIO_GetDataString( data );
+  if( dataString == NULL )
+  {
+    fprintf( stderr, "data_io_fuzz: loaded data serialization failed\n" );
+    abort();
+  }
+
+  DataHandle loadedData = DataIO_LoadStringData( dataString );
+  if( loadedData == NULL || ( hasComparison && !DataIO_CompareData( data, loadedData ) ) )
+  {
+    fprintf( stderr, "data_io_fuzz: serialized data doesn't load back to the same content:\n%s\n", dataString );
+    abort();
+  }
+
+  free( dataString );
+  DataIO_UnloadData( loadedData );
+  DataIO_UnloadData( data );
+
+  return 0;
+}
+
+#ifdef DATA_IO_FUZZ_STANDALONE
+int main( int argc, char* argv[] )
+{
+  LLVMFuzzerInitialize( &argc, &argv );
+
+  for( int argIndex = 1; argIndex < argc; argIndex++ )
+  {
+    FILE* inputFile = fopen( argv[ argIndex ], "rb" );
+    if( inputFile == NULL )
+    {
+      fprintf( stderr, "data_io_fuzz: can't open input %s\n", argv[ argIndex ] );
+      return EXIT_FAILURE;
+    }
+    fseek( inputFile, 0, SEEK_END );
+    long inputLength = ftell( inputFile );
+    rewind( inputFile );
+    uint8_t* input = (uint8_t*) malloc( ( inputLength > 0 ) ? (size_t) inputLength : 1 );
+    size_t readLength = ( input != NULL && inputLength > 0 ) ? fread( input, 1, (size_t) inputLength, inputFile ) : 0;
+    fclose( inputFile );
+    if( input == NULL ) return EXIT_FAILURE;
+
+    printf( "data_io_fuzz: running %s (%lu bytes)\n", argv[ argIndex ], (unsigned long) readLength );
+    LLVMFuzzerTestOneInput( input, readLength );
+    free( input );
+  }
+
+  return EXIT_SUCCESS;
+}
+#endif
@@ -0,0 +1,108 @@
+//////////////////////////////////////////////////////////////////////////////////
+//                                                                              //
+//  Copyright (c) 2016-2018 Leonardo Consoni <consoni_2519@hotmail.com>         //
+//                                                                              //
+//  This file is part of Data I/O Interface.                                    //
+//                                                                              //
+//  Data I/O Interface is free software: you can redistribute it and/or modify  //
+//  it under the terms of the GNU Lesser General Public License as published    //
+//  by the Free Software Foundation, either version 3 of the License, or        //
+//  (at your option) any later version.                                         //
+//                                                                              //
+//  Data I/O Interface is distributed in the hope that it will be useful,       //
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of              //
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                //
+//  GNU Lesser General Public License for more details.                         //
+//                                                                              //
+//  You should have received a copy of the GNU Lesser General Public License    //
+//  along with Data I/O Interface. If not, see <http://www.gnu.org/licenses/>.  //
+//                                                                              //
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+/// @file data_io_roundtrip.c
+/// @brief Differential round-trip test of string parsing and serialization: load -> serialize -> load -> compare
+///
+/// Usage: data_io_roundtrip [storage_path ...]
+/// Checks a generated document covering every value type and nesting, plus the storage entries given as arguments.
+/// Exits with 0 if every round trip keeps the content, 1 otherwise and 77 (skipped) if no implementation with
+/// DataIO_CompareData is set in DATA_IO_BACKEND_VARIABLE
+
+#define TEST_NAME "data_io_roundtrip"
+
+#include "data_io_test.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// Values kept exactly by decimal serialization with enough digits
+static const double NUMBERS_LIST[] = { 0.0, -1.0, 0.1, 1.0 / 3.0, -2.5e-300, 1.7976931348623157e308, 4294967297.0 };
+static const char* STRINGS_LIST[] = { "", "plain", "with spaces and \"quotes\"", "line\nbreak\ttab\\backslash", "key: value, [list] {level} # comment", "unicode \xc3\xa1\xe2\x82\xac" };
+
+// Sample document extended with every value type and nesting: extreme numbers, escaped strings, empty and mixed lists, deep levels
+static DataHandle BuildDocument( void )
+{
+  DataHandle data = BuildSampleDocument();
+  DataHandle numbersList = DataIO_AddList( data, "numbers" );
+  for( size_t index = 0; index < sizeof(NUMBERS_LIST) / sizeof(double); index++ )
+    DataIO_SetNumericValue( numbersList, NULL, NUMBERS_LIST[ index ] );
+  DataHandle stringsList = DataIO_AddList( data, "strings" );
+  for( size_t index = 0; index < sizeof(STRINGS_LIST) / sizeof(char*); index++ )
+    DataIO_SetStringValue( stringsList, NULL, STRINGS_LIST[ index ] );
+  DataIO_SetBooleanValue( data, "enabled", true );
+  DataIO_SetBooleanValue( data, "disabled", false );
+  DataIO_AddList( data, "empty_list" );
+  DataIO_AddLevel( data, "empty_level" );
+  DataHandle level = DataIO_AddLevel( data, "nested" );
+  DataIO_SetStringValue( level, "name", "nested" );
+  DataHandle mixedList = DataIO_AddList( level, "mixed" );
+  DataIO_SetNumericValue( mixedList, NULL, 1.0 );
+  DataIO_SetStringValue( mixedList, NULL, "two" );
+  DataIO_SetBooleanValue( mixedList, NULL, true );
+  DataIO_SetNumericValue( DataIO_AddLevel( mixedList, NULL ), "x", 4.0 );
+  DataIO_SetNumericValue( DataIO_AddList( mixedList, NULL ), NULL, 5.0 );
+  DataHandle deepLevel = level;
+  for( size_t depth = 0; depth < 16; depth++ )
+    deepLevel = DataIO_AddLevel( deepLevel, "deep" );
+  DataIO_SetNumericValue( deepLevel, "bottom", 16.0 );
+  return data;
+}
+
+static bool CheckRoundTrip( DataHandle data, const char* name )
+{
+  char* dataString = DataIO_GetDataString( data );
+  if( dataString == NULL )
+  {
+    fprintf( stderr, "data_io_roundtrip: %s serialization failed\n", name );
+    return false;
+  }
+
+  DataHandle loadedData = DataIO_LoadStringData( dataString );
+  bool isEqual = DataIO_CompareData( data, loadedData );
+  if( !isEqual ) fprintf( stderr, "data_io_roundtrip: %s content changed by round trip:\n%s\n", name, dataString );
+  free( dataString );
+  DataIO_UnloadData( loadedData );
+
+  return isEqual;
+}
+
+int main( int argc, char* argv[] )
+{
+  RequireBackendFunction( "DataIO_CompareData", "data comparison" );
+
+  DataHandle data = BuildDocument();
+  CHECK( DataIO_CompareData( data, data ), "self comparison" );
+  CHECK( CheckRoundTrip( data, "generated document" ), "round trip" );
+  DataIO_UnloadData( data );
+
+  for( int argIndex = 1; argIndex < argc; argIndex++ )
+  {
+    data = DataIO_LoadStorageData( argv[ argIndex ] );
+    if( data == NULL ) fprintf( stderr, "data_io_roundtrip: %s loading failed\n", argv[ argIndex ] );
+    CHECK( data != NULL && CheckRoundTrip( data, argv[ argIndex ] ), "storage round trip" );
+    DataIO_UnloadData( data );
+  }
+
+  return GetTestResult( "all round trips kept the content" );
+}
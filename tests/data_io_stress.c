@@ -0,0 +1,165 @@
+//////////////////////////////////////////////////////////////////////////////////
+//                                                                              //
+//  Copyright (c) 2016-2018 Leonardo Consoni <consoni_2519@hotmail.com>         //
+//                                                                              //
+//  This file is part of Data I/O Interface.                                    //
+//                                                                              //
+//  Data I/O Interface is free software: you can redistribute it and/or modify  //
+//  it under the terms of the GNU Lesser General Public License as published    //
+//  by the Free Software Foundation, either version 3 of the License, or        //
+//  (at your option) any later version.                                         //
+//                                                                              //
+//  Data I/O Interface is distributed in the hope that it will be useful,       //
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of              //
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                //
+//  GNU Lesser General Public License for more details.                         //
+//                                                                              //
+//  You should have received a copy of the GNU Lesser General Public License    //
+//  along with Data I/O Interface. If not, see <http://www.gnu.org/licenses/>.  //
+//                                                                              //
+//////////////////////////////////////////////////////////////////////////////////
+
+
+
+/// @file data_io_stress.c
+/// @brief Concurrency stress test of one data structure shared between writer and reader threads
+///
+/// With DATA_IO_CONCURRENT_SUBTREES, each writer thread changes its own subtree while reader threads query the whole
+/// structure; with only DATA_IO_CONCURRENT_READS, readers run alone. Meant to be built with -fsanitize=thread
+/// (DATA_IO_ENABLE_TSAN), over an implementation also built with it, so that data races are reported.
+/// Exits with 0 on success, 1 on failures and 77 (skipped) if no implementation with concurrent modes is set
+
+#define TEST_NAME "data_io_stress"
+
+#include "data_io_test.h"
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define WRITERS_NUMBER 4
+#define READERS_NUMBER 4
+#define WRITER_ITERATIONS 20000
+#define READER_ITERATIONS 20000
+#define CONFIG_VALUES_NUMBER 16
+#define MAX_LIST_SIZE 256
+
+static DataHandle sharedData = NULL;
+static DataHandle subtreesList[ WRITERS_NUMBER ];
+static bool hasWriters = false;
+static pthread_mutex_t failuresLock = PTHREAD_MUTEX_INITIALIZER;
+
+// Counted like CHECK failures, but locked and reported only for the first ones, as threads may fail many times
+static void ReportFailure( const char* message, unsigned long threadIndex )
+{
+  pthread_mutex_lock( &failuresLock );
+  if( failuresCount++ < 10 ) fprintf( stderr, "data_io_stress: thread %lu: %s\n", threadIndex, message );
+  pthread_mutex_unlock( &failuresLock );
+}
+
+// Read-only configuration plus one subtree per writer: { config: { c0: 0, ... }, name: "stress", workers: [ { counter: 0, values: [] }, ... ] }
+static DataHandle BuildDocument( void )
+{
+  char key[ 16 ];
+
+  DataHandle data = DataIO_CreateEmptyData();
+  DataHandle config = DataIO_AddLevel( data, "config" );
+  for( size_t valueIndex = 0; valueIndex < CONFIG_VALUES_NUMBER; valueIndex++ )
+  {
+    snprintf( key, sizeof(key), "c%lu", (unsigned long) valueIndex );
+    DataIO_SetNumericValue( config, key, (double) valueIndex );
+  }
+  DataIO_SetStringValue( data, "name", "stress" );
+  DataHandle workersList = DataIO_AddList( data, "workers" );
+  for( size_t writerIndex = 0; writerIndex < WRITERS_NUMBER; writerIndex++ )
+  {
+    subtreesList[ writerIndex ] = DataIO_AddLevel( workersList, NULL );
+    DataIO_SetNumericValue( subtreesList[ writerIndex ], "counter", 0.0 );
+    DataIO_AddList( subtreesList[ writerIndex ], "values" );
+  }
+  return data;
+}
+
+static void* RunWriter( void* args )
+{
+  unsigned long writerIndex = (unsigned long) (size_t) args;
+  DataHandle subtree = subtreesList[ writerIndex ];
+  DataHandle valuesList = DataIO_GetSubData( subtree, "values" );
+
+  for( size_t iteration = 1; iteration <= WRITER_ITERATIONS; iteration++ )
+  {
+    if( !DataIO_SetNumericValue( subtree, "counter", (double) iteration ) ) ReportFailure( "counter setting failed", writerIndex );
+    DataIO_SetBooleanValue( subtree, "odd", ( iteration % 2 == 1 ) );
+    if( iteration <= MAX_LIST_SIZE && !DataIO_SetNumericValue( valuesList, NULL, (double) iteration ) ) ReportFailure( "value appending failed", writerIndex );
+    if( DataIO_GetNumericValue( subtree, -1.0, "counter" ) != (double) iteration ) ReportFailure( "own write not visible", writerIndex );
+  }
+
+  return NULL;
+}
+
+static void* RunReader( void* args )
+{
+  unsigned long readerIndex = (unsigned long) (size_t) args;
+  double lastCountersList[ WRITERS_NUMBER ] = { 0.0 };
+  size_t lastSizesList[ WRITERS_NUMBER ] = { 0 };
+
+  for( size_t iteration = 0; iteration < READER_ITERATIONS; iteration++ )
+  {
+    size_t valueIndex = iteration % CONFIG_VALUES_NUMBER;
+    if( DataIO_GetNumericValue( sharedData, -1.0, "config.c%lu", (unsigned long) valueIndex ) != (double) valueIndex ) ReportFailure( "wrong config value", readerIndex );
+    const char* name = DataIO_GetStringValue( sharedData, NULL, "name" );
+    if( name == NULL || strcmp( name, "stress" ) != 0 ) ReportFailure( "wrong name", readerIndex );
+    if( DataIO_GetListSize( sharedData, "workers" ) != WRITERS_NUMBER ) ReportFailure( "wrong workers number", readerIndex );
+
+    // Values written concurrently are seen either old or new, so they only grow
+    size_t writerIndex = iteration % WRITERS_NUMBER;
+    double counter = DataIO_GetNumericValue( sharedData, -1.0, "workers.%lu.counter", (unsigned long) writerIndex );
+    if( counter < lastCountersList[ writerIndex ] || counter > WRITER_ITERATIONS ) ReportFailure( "inconsistent counter", readerIndex );
+    lastCountersList[ writerIndex ] = counter;
+    size_t valuesCount = DataIO_GetListSize( sharedData, "workers.%lu.values", (unsigned long) writerIndex );
+    if( valuesCount < lastSizesList[ writerIndex ] || valuesCount > MAX_LIST_SIZE ) ReportFailure( "inconsistent list size", readerIndex );
+    lastSizesList[ writerIndex ] = valuesCount;
+    if( valuesCount > 0 && DataIO_GetNumericValue( sharedData, -1.0, "workers.%lu.values.%lu", (unsigned long) writerIndex, (unsigned long) ( valuesCount - 1 ) ) != (double) valuesCount )
+      ReportFailure( "wrong appended value", readerIndex );
+  }
+
+  return NULL;
+}
+
+int main( void )
+{
+  pthread_t writersList[ WRITERS_NUMBER ], readersList[ READERS_NUMBER ];
+
+  RequireBackendFunction( "DataIO_SetConcurrencyMode", "concurrency modes" );
+
+  sharedData = BuildDocument();
+  if( DataIO_SetConcurrencyMode( sharedData, DATA_IO_CONCURRENT_SUBTREES ) ) hasWriters = true;
+  else if( !DataIO_SetConcurrencyMode( sharedData, DATA_IO_CONCURRENT_READS ) )
+  {
+    printf( "data_io_stress: implementation supports no concurrent mode, skipping\n" );
+    DataIO_UnloadData( sharedData );
+    return TEST_SKIPPED;
+  }
+
+  size_t writersNumber = hasWriters ? WRITERS_NUMBER : 0;
+  for( size_t writerIndex = 0; writerIndex < writersNumber; writerIndex++ )
+    pthread_create( &(writersList[ writerIndex ]), NULL, RunWriter, (void*) writerIndex );
+  for( size_t readerIndex = 0; readerIndex < READERS_NUMBER; readerIndex++ )
+    pthread_create( &(readersList[ readerIndex ]), NULL, RunReader, (void*) readerIndex );
+  for( size_t writerIndex = 0; writerIndex < writersNumber; writerIndex++ )
+    pthread_join( writersList[ writerIndex ], NULL );
+  for( size_t readerIndex = 0; readerIndex < READERS_NUMBER; readerIndex++ )
+    pthread_join( readersList[ readerIndex ], NULL );
+
+  for( size_t writerIndex = 0; writerIndex < writersNumber; writerIndex++ )
+  {
+    if( DataIO_GetNumericValue( subtreesList[ writerIndex ], -1.0, "counter" ) != WRITER_ITERATIONS ) ReportFailure( "wrong final counter", writerIndex );
+    if( DataIO_GetListSize( subtreesList[ writerIndex ], "values" ) != MAX_LIST_SIZE ) ReportFailure( "wrong final list size", writerIndex );
+  }
+  DataIO_UnloadData( sharedData );
+
+  char resultMessage[ 64 ];
+  snprintf( resultMessage, sizeof(resultMessage), "%lu writers and %d readers finished consistently", (unsigned long) writersNumber, READERS_NUMBER );
+  return GetTestResult( resultMessage );
+}
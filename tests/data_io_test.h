@@ -0,0 +1,92 @@
+//////////////////////////////////////////////////////////////////////////////////
+//                                                                              //
+//  Copyright (c) 2016-2018 Leonardo Consoni <consoni_2519@hotmail.com>         //
+//                                                                              //
+//  This file is part of Data I/O Interface.                                    //
+//                                                                              //
+//  Data I/O Interface is free software: you can redistribute it and/or modify  //
+//  it under the terms of the GNU Lesser General Public License as published    //
+//  by the Free Software Foundation, either version 3 of the License, or        //
+//  (at your option) any later version.                                         //
+//                                                                              //
+//  Data I/O Interface is distributed in the hope that it will be useful,       //
+//  but WITHOUT ANY WARRANTY; without even the implied warranty of              //
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                //
+//  GNU Lesser General Public License for more details.                         //
+//                                                                              //
+//  You should have received a copy of the GNU Lesser General Public License    //
+//  along with Data I/O Interface. If not, see <http://www.gnu.org/licenses/>.  //
+//                                                                              //
+//////////////////////////////////////////////////////////////////////////////////
+
+
+/// @file data_io_test.h
+/// @brief Scaffolding shared by test programs: skip exit code, counted checks, implementation requirement and sample document
+///
+/// Programs define TEST_NAME (used as message prefix) before including it
+
+#ifndef DATA_IO_TEST_H
+#define DATA_IO_TEST_H
+
+#include "data_io.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifndef TEST_NAME
+#error "TEST_NAME must be defined before including data_io_test.h"
+#endif
+
+#define TEST_SKIPPED 77     ///< Exit code of skipped tests (SKIP_RETURN_CODE of ctest)
+
+static size_t failuresCount = 0;
+
+/// Count and report failure of given condition, labeled by the checked rule
+#define CHECK( condition, rule ) CheckCondition( (condition), rule, #condition, __LINE__ )
+
+static inline void CheckCondition( bool isValid, const char* rule, const char* condition, int line )
+{
+  if( isValid ) return;
+  fprintf( stderr, TEST_NAME ": [%s] failed: %s (line %d)\n", rule, condition, line );
+  failuresCount++;
+}
+
+/// @brief Exit as skipped unless the implementation set in DATA_IO_BACKEND_VARIABLE provides given function (loading it on first call)
+/// @param[in] functionName name of required interface function
+/// @param[in] featureName description of required feature, for the skip message
+static inline void RequireBackendFunction( const char* functionName, const char* featureName )
+{
+  if( DataIO_GetBackendFunction( functionName ) != NULL ) return;
+  printf( TEST_NAME ": no implementation with %s set in " DATA_IO_BACKEND_VARIABLE ", skipping\n", featureName );
+  exit( TEST_SKIPPED );
+}
+
+/// @return process exit code for the failures counted so far, reported along with the success message otherwise
+static inline int GetTestResult( const char* successMessage )
+{
+  if( failuresCount > 0 )
+  {
+    fprintf( stderr, TEST_NAME ": %lu checks failed\n", (unsigned long) failuresCount );
+    return EXIT_FAILURE;
+  }
+
+  printf( TEST_NAME ": %s\n", successMessage );
+  return EXIT_SUCCESS;
+}
+
+/// @brief Build document with one field of each type: { number: 1, text: "value", flag: true, level: { x: 2 }, list: [ 0, 1, 2 ] }
+/// @return reference to newly created data structure (NULL on errors)
+static inline DataHandle BuildSampleDocument( void )
+{
+  DataHandle data = DataIO_CreateEmptyData();
+  DataIO_SetNumericValue( data, "number", 1.0 );
+  DataIO_SetStringValue( data, "text", "value" );
+  DataIO_SetBooleanValue( data, "flag", true );
+  DataIO_SetNumericValue( DataIO_AddLevel( data, "level" ), "x", 2.0 );
+  DataHandle list = DataIO_AddList( data, "list" );
+  for( size_t index = 0; index < 3; index++ )
+    DataIO_SetNumericValue( list, NULL, (double) index );
+  return data;
+}
+
+#endif // DATA_IO_TEST_H